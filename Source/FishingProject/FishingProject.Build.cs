@@ -6,9 +6,12 @@ public class FishingProject : ModuleRules
 {
 	public FishingProject(ReadOnlyTargetRules Target) : base(Target)
 	{
-		PrivateDependencyModuleNames.AddRange(new string[] { "CableComponent", "EnhancedInput", "MessageLog", "ProceduralMeshComponent" });
+		PrivateDependencyModuleNames.AddRange(new string[] { "CableComponent", "EnhancedInput", "MessageLog", "ProceduralMeshComponent", "Chaos", "PhysicsCore", "RenderCore", "RHI" });
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
 		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore" });
+
+		// Private/*.ispc kernels are compiled by UBT for every ISPC target of the platform (AVX2/AVX-512 variants on x64).
+		// They are opt-in at runtime through r.Fishing.Line.ISPCConstraints, so every build solves the same way by default.
 	}
 }
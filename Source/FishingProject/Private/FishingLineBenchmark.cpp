@@ -0,0 +1,369 @@
+// FishingLineBenchmark.cpp
+// Console command for timing the fishing line solver kernels outside of a running game.
+// Usage: Fishing.Line.Benchmark [NumParticles=501] [NumFrames=300] [SolverIterations=10]
+
+#include "FishingLineComponent.h"
+#include "FishingLineSolver.h"
+#include "FishingLogChannels.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Async/ParallelFor.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace FishingLineBenchmark
+{
+    static const float BenchDeltaTime = 1.0f / 60.0f;
+    static const float BenchSegmentLength = 10.0f;
+    static const float BenchDamping = 0.1f;
+    static const float BenchStiffness = 0.85f;
+    static const float BenchParticleMass = 0.01f;
+    static const float BenchCompliance = 0.0001f;
+    static const FVector BenchGravity(0.0f, 0.0f, -980.0f);
+    /** BenchGravity for the FFishingLineParticles kernels, which run in single precision. */
+    static const FVector3f BenchSolverGravity(BenchGravity);
+
+    /** Horizontal line pinned at the first particle, so it swings down and keeps every constraint busy. */
+    static void MakeInitialPoints(TArray<FVerletPoint>& OutPoints, int32 NumParticles)
+    {
+        OutPoints.Reset(NumParticles);
+        for (int32 i = 0; i < NumParticles; ++i)
+        {
+            OutPoints.Emplace(FVector(i * BenchSegmentLength, 0.0f, 0.0f), BenchParticleMass, i == 0);
+        }
+    }
+
+    // --- ARRAY-OF-STRUCTS REFERENCE ---
+    // The solver as it was before particle storage moved to FFishingLineParticles. Kept only as the "before" column.
+
+    static void SimulateAoS(TArray<FVerletPoint>& Points, int32 NumFrames, int32 Iterations)
+    {
+        const int32 NumSegments = Points.Num() - 1;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 i = 1; i < Points.Num(); ++i)
+            {
+                Points[i].Integrate(BenchDeltaTime, BenchDamping, BenchGravity);
+            }
+
+            for (int32 Iter = 0; Iter < Iterations; ++Iter)
+            {
+                for (int32 i = 0; i < NumSegments; ++i)
+                {
+                    FVerletPoint& P1 = Points[i];
+                    FVerletPoint& P2 = Points[i + 1];
+
+                    FVector Delta = P2.Position - P1.Position;
+                    float CurrentLength = Delta.Size();
+                    if (CurrentLength < KINDA_SMALL_NUMBER) continue;
+
+                    FVector Correction = (Delta / CurrentLength) * (CurrentLength - BenchSegmentLength) * BenchStiffness;
+
+                    float P1_MoveRatio, P2_MoveRatio;
+                    if (P1.bIsFixed && P2.bIsFixed) { P1_MoveRatio = 0.0f; P2_MoveRatio = 0.0f; }
+                    else if (P1.bIsFixed) { P1_MoveRatio = 0.0f; P2_MoveRatio = 1.0f; }
+                    else if (P2.bIsFixed) { P1_MoveRatio = 1.0f; P2_MoveRatio = 0.0f; }
+                    else { P1_MoveRatio = 0.5f; P2_MoveRatio = 0.5f; }
+
+                    if (P1_MoveRatio > 0.0f) P1.Position += Correction * P1_MoveRatio;
+                    if (P2_MoveRatio > 0.0f) P2.Position -= Correction * P2_MoveRatio;
+                }
+            }
+        }
+    }
+
+    // --- STRUCTURE-OF-ARRAYS PATH ---
+
+    static void SimulateSoA(FFishingLineParticles& Particles, int32 NumFrames, int32 Iterations)
+    {
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            FishingLineSolver::Integrate(Particles, 1, Particles.Num(), BenchDeltaTime, BenchDamping, BenchSolverGravity);
+            FishingLineSolver::SolveDistanceConstraints(Particles, Iterations, BenchStiffness);
+        }
+    }
+
+    // --- SOLVER COMPARISON ---
+
+    static FFishingLineParticles MakeParticles(const TArray<FVerletPoint>& InitialPoints)
+    {
+        FFishingLineParticles Particles;
+        Particles.Reset(InitialPoints.Num());
+        for (const FVerletPoint& Point : InitialPoints)
+        {
+            Particles.AddPoint(Point);
+        }
+        Particles.RestLengths.Init(BenchSegmentLength, FMath::Max(0, Particles.Num() - 1));
+        return Particles;
+    }
+
+    /** Largest relative segment stretch, |length - rest| / rest, i.e. how far the solver is from an inextensible line. */
+    static double MeasureMaxStretch(const FFishingLineParticles& Particles)
+    {
+        double MaxStretch = 0.0;
+        for (int32 i = 0; i + 1 < Particles.Num(); ++i)
+        {
+            const double Length = FVector3f::Dist(Particles.Positions[i], Particles.Positions[i + 1]);
+            const double RestLength = Particles.RestLengths[i];
+            MaxStretch = FMath::Max(MaxStretch, FMath::Abs(Length - RestLength) / RestLength);
+        }
+        return MaxStretch;
+    }
+
+    /** Integrates and runs Solve for NumFrames, then logs the time against BaselineSeconds and the final stretch. */
+    static double RunSolver(const TCHAR* Label, const TArray<FVerletPoint>& InitialPoints, int32 NumFrames, double BaselineSeconds,
+        TFunctionRef<void(FFishingLineParticles&)> Solve)
+    {
+        FFishingLineParticles Particles = MakeParticles(InitialPoints);
+
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            FishingLineSolver::Integrate(Particles, 1, Particles.Num(), BenchDeltaTime, BenchDamping, BenchSolverGravity);
+            Solve(Particles);
+        }
+        const double Seconds = FPlatformTime::Seconds() - Start;
+
+        UE_LOG(LogFishingSystemLine, Display, TEXT("  %s: %8.3f ms total, %7.2f us/frame (%.2fx), max stretch %.3f%%"),
+            Label, Seconds * 1000.0, Seconds * 1e6 / NumFrames, (BaselineSeconds > 0.0 && Seconds > 0.0) ? BaselineSeconds / Seconds : 1.0,
+            MeasureMaxStretch(Particles) * 100.0);
+        return Seconds;
+    }
+
+    // --- MULTIGRID ---
+
+    /**
+     * Gauss-Seidel at full iterations against Multigrid at a quarter of the fine sweeps, on short, medium and long lines.
+     * Stretch on a long line is mostly low-frequency, which is where the coarse levels should pay for themselves.
+     */
+    static void RunMultigrid(int32 NumFrames, int32 Iterations)
+    {
+        const int32 FineIterations = FMath::Max(1, Iterations / 4);
+        FFishingLineSolverScratch Scratch;
+
+        for (int32 NumParticles : { 100, 500, 1000 })
+        {
+            TArray<FVerletPoint> InitialPoints;
+            MakeInitialPoints(InitialPoints, NumParticles);
+            UE_LOG(LogFishingSystemLine, Display, TEXT("  Multigrid comparison, %d particles:"), NumParticles);
+
+            const double GaussSeidelSeconds = RunSolver(*FString::Printf(TEXT("  Gauss-Seidel, %d iterations"), Iterations), InitialPoints, NumFrames, 0.0,
+                [Iterations](FFishingLineParticles& Particles) { FishingLineSolver::SolveDistanceConstraints(Particles, Iterations, BenchStiffness); });
+
+            RunSolver(*FString::Printf(TEXT("  Gauss-Seidel, %d iterations"), FineIterations), InitialPoints, NumFrames, GaussSeidelSeconds,
+                [FineIterations](FFishingLineParticles& Particles) { FishingLineSolver::SolveDistanceConstraints(Particles, FineIterations, BenchStiffness); });
+
+            for (int32 Levels : { 2, 3 })
+            {
+                RunSolver(*FString::Printf(TEXT("  Multigrid, %d levels x8, %d fine iterations"), Levels, FineIterations), InitialPoints, NumFrames, GaussSeidelSeconds,
+                    [&Scratch, Levels, FineIterations](FFishingLineParticles& Particles)
+                    {
+                        FishingLineSolver::SolveCoarseLevels(Particles, Scratch, Levels, 8, 4);
+                        FishingLineSolver::SolveDistanceConstraints(Particles, FineIterations, BenchStiffness);
+                    });
+            }
+        }
+    }
+
+    // --- PARALLEL SOLVE ---
+
+    /**
+     * The parallel solve as it was first written: a red-black sweep with one ParallelFor per colour per sweep, 32 segments
+     * per task. Kept only as the "before" column of RunParallel.
+     */
+    static void SolveRedBlackPerColourDispatch(FFishingLineParticles& Particles, int32 Iterations)
+    {
+        const int32 NumSegments = Particles.Num() - 1;
+        FVector3f* Positions = Particles.Positions.GetData();
+        const uint8* Flags = Particles.Flags.GetData();
+        const float* RestLengths = Particles.RestLengths.GetData();
+        const int32 SegmentsPerTask = 32;
+
+        for (int32 Iter = 0; Iter < Iterations; ++Iter)
+        {
+            for (int32 Parity = 0; Parity < 2; ++Parity)
+            {
+                const int32 NumInColour = (NumSegments - Parity + 1) / 2;
+                ParallelFor(FMath::DivideAndRoundUp(NumInColour, SegmentsPerTask), [=](int32 TaskIndex)
+                {
+                    const int32 Last = FMath::Min(TaskIndex * SegmentsPerTask + SegmentsPerTask, NumInColour);
+                    for (int32 j = TaskIndex * SegmentsPerTask; j < Last; ++j)
+                    {
+                        const int32 i = 2 * j + Parity;
+                        const FVector3f Delta = Positions[i + 1] - Positions[i];
+                        const float Length = Delta.Size();
+                        if (Length < KINDA_SMALL_NUMBER) continue;
+
+                        const FVector3f Correction = (Delta / Length) * (Length - RestLengths[i]) * BenchStiffness;
+                        const bool bFixed1 = (Flags[i] & FFishingLineParticles::Flag_Fixed) != 0;
+                        const bool bFixed2 = (Flags[i + 1] & FFishingLineParticles::Flag_Fixed) != 0;
+                        if (bFixed1 && bFixed2) continue;
+                        if (!bFixed1) Positions[i] += Correction * (bFixed2 ? 1.0f : 0.5f);
+                        if (!bFixed2) Positions[i + 1] -= Correction * (bFixed1 ? 1.0f : 0.5f);
+                    }
+                });
+            }
+        }
+    }
+
+    /**
+     * Sequential Gauss-Seidel against the old per-colour dispatch and the block solve the component uses, at the default
+     * parallel threshold and on longer lines.
+     */
+    static void RunParallel(int32 NumFrames, int32 Iterations)
+    {
+        for (int32 NumParticles : { 256, 1024, 4096 })
+        {
+            TArray<FVerletPoint> InitialPoints;
+            MakeInitialPoints(InitialPoints, NumParticles);
+            UE_LOG(LogFishingSystemLine, Display, TEXT("  Parallel solve comparison, %d particles:"), NumParticles);
+
+            const double GaussSeidelSeconds = RunSolver(TEXT("  Gauss-Seidel, one thread"), InitialPoints, NumFrames, 0.0,
+                [Iterations](FFishingLineParticles& Particles) { FishingLineSolver::SolveDistanceConstraints(Particles, Iterations, BenchStiffness); });
+
+            RunSolver(TEXT("  Red-black, dispatch per colour and sweep (before)"), InitialPoints, NumFrames, GaussSeidelSeconds,
+                [Iterations](FFishingLineParticles& Particles) { SolveRedBlackPerColourDispatch(Particles, Iterations); });
+
+            RunSolver(TEXT("  Blocks of 256, two dispatches (after)"), InitialPoints, NumFrames, GaussSeidelSeconds,
+                [Iterations](FFishingLineParticles& Particles) { FishingLineSolver::SolveDistanceConstraintsParallel(Particles, Iterations, BenchStiffness, 256); });
+        }
+    }
+
+    // --- INTEGRATION ONLY ---
+
+    /**
+     * Max distance the vectorized integrator may drift from the scalar one before the benchmark reports a mismatch.
+     * Both run in float, and over the default 300 frames the free-falling line ends up over a hundred metres from its
+     * origin, where one ulp is already about a thousandth of a centimetre. This is only a sanity check on the timed run;
+     * the FishingProject.Line.Integrate automation test checks agreement tightly on a short run.
+     */
+    static const double IntegrateTolerance = 1e-2;
+
+    static double TimeIntegrate(FFishingLineParticles& Particles, int32 NumFrames, bool bVectorized)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            if (bVectorized)
+            {
+                FishingLineSolver::IntegrateVectorized(Particles, 1, Particles.Num(), BenchDeltaTime, BenchDamping, BenchSolverGravity);
+            }
+            else
+            {
+                FishingLineSolver::Integrate(Particles, 1, Particles.Num(), BenchDeltaTime, BenchDamping, BenchSolverGravity);
+            }
+        }
+        return FPlatformTime::Seconds() - Start;
+    }
+
+    static void RunIntegrate(const TArray<FVerletPoint>& InitialPoints, int32 NumFrames)
+    {
+        // Pin a scattering of interior particles so the fixed-particle mask is exercised, not just the range ends.
+        FFishingLineParticles ScalarParticles;
+        ScalarParticles.Reset(InitialPoints.Num());
+        for (const FVerletPoint& Point : InitialPoints)
+        {
+            ScalarParticles.AddPoint(Point);
+        }
+        for (int32 i = 0; i < ScalarParticles.Num(); i += 7)
+        {
+            ScalarParticles.SetFixed(i, true);
+        }
+        FFishingLineParticles VectorParticles = ScalarParticles;
+
+        const double ScalarSeconds = TimeIntegrate(ScalarParticles, NumFrames, false);
+        const double VectorSeconds = TimeIntegrate(VectorParticles, NumFrames, true);
+
+        double MaxDeviation = 0.0;
+        for (int32 i = 0; i < ScalarParticles.Num(); ++i)
+        {
+            MaxDeviation = FMath::Max(MaxDeviation, double(FVector3f::Dist(ScalarParticles.Positions[i], VectorParticles.Positions[i])));
+            MaxDeviation = FMath::Max(MaxDeviation, double(FVector3f::Dist(ScalarParticles.OldPositions[i], VectorParticles.OldPositions[i])));
+        }
+
+        UE_LOG(LogFishingSystemLine, Display, TEXT("  Integrate scalar:     %8.3f ms total, %7.2f us/frame"), ScalarSeconds * 1000.0, ScalarSeconds * 1e6 / NumFrames);
+        UE_LOG(LogFishingSystemLine, Display, TEXT("  Integrate vectorized: %8.3f ms total, %7.2f us/frame (%.2fx), max deviation %.6f"),
+            VectorSeconds * 1000.0, VectorSeconds * 1e6 / NumFrames, VectorSeconds > 0.0 ? ScalarSeconds / VectorSeconds : 0.0, MaxDeviation);
+        if (MaxDeviation > IntegrateTolerance)
+        {
+            UE_LOG(LogFishingSystemLine, Error, TEXT("  Integrate vectorized path deviates from the scalar path by %.6f (tolerance %.6f)."), MaxDeviation, IntegrateTolerance);
+        }
+    }
+
+    static void Run(const TArray<FString>& Args)
+    {
+        const int32 NumParticles = Args.IsValidIndex(0) ? FMath::Max(2, FCString::Atoi(*Args[0])) : 501;
+        const int32 NumFrames = Args.IsValidIndex(1) ? FMath::Max(1, FCString::Atoi(*Args[1])) : 300;
+        const int32 Iterations = Args.IsValidIndex(2) ? FMath::Max(1, FCString::Atoi(*Args[2])) : 10;
+
+        TArray<FVerletPoint> InitialPoints;
+        MakeInitialPoints(InitialPoints, NumParticles);
+
+        TArray<FVerletPoint> AoSPoints = InitialPoints;
+        const double AoSStart = FPlatformTime::Seconds();
+        SimulateAoS(AoSPoints, NumFrames, Iterations);
+        const double AoSSeconds = FPlatformTime::Seconds() - AoSStart;
+
+        FFishingLineParticles SoAParticles = MakeParticles(InitialPoints);
+        const double SoAStart = FPlatformTime::Seconds();
+        SimulateSoA(SoAParticles, NumFrames, Iterations);
+        const double SoASeconds = FPlatformTime::Seconds() - SoAStart;
+
+        double MaxDeviation = 0.0;
+        for (int32 i = 0; i < NumParticles; ++i)
+        {
+            MaxDeviation = FMath::Max(MaxDeviation, FVector::Dist(AoSPoints[i].Position, SoAParticles.GetWorldPosition(i)));
+        }
+
+        UE_LOG(LogFishingSystemLine, Display, TEXT("Fishing.Line.Benchmark: %d particles, %d frames, %d iterations."), NumParticles, NumFrames, Iterations);
+        UE_LOG(LogFishingSystemLine, Display, TEXT("  AoS (FVerletPoint array): %8.3f ms total, %7.2f us/frame"), AoSSeconds * 1000.0, AoSSeconds * 1e6 / NumFrames);
+        UE_LOG(LogFishingSystemLine, Display, TEXT("  SoA (FFishingLineParticles): %8.3f ms total, %7.2f us/frame (%.2fx), max deviation from AoS %.4f"),
+            SoASeconds * 1000.0, SoASeconds * 1e6 / NumFrames, SoASeconds > 0.0 ? AoSSeconds / SoASeconds : 0.0, MaxDeviation);
+
+        // Solver modes, timed against the Gauss-Seidel sweep the component uses by default.
+        const double GaussSeidelSeconds = RunSolver(TEXT("Gauss-Seidel"), InitialPoints, NumFrames, 0.0,
+            [Iterations](FFishingLineParticles& Particles) { FishingLineSolver::SolveDistanceConstraints(Particles, Iterations, BenchStiffness); });
+
+        RunSolver(TEXT("Gauss-Seidel + tethers, 1/4 iterations"), InitialPoints, NumFrames, GaussSeidelSeconds,
+            [Iterations](FFishingLineParticles& Particles)
+            {
+                FishingLineSolver::ApplyLongRangeAttachments(Particles, 0);
+                FishingLineSolver::SolveDistanceConstraints(Particles, FMath::Max(1, Iterations / 4), BenchStiffness);
+                FishingLineSolver::ApplyLongRangeAttachments(Particles, 0);
+            });
+
+        RunSolver(TEXT("Parallel blocks"), InitialPoints, NumFrames, GaussSeidelSeconds,
+            [Iterations](FFishingLineParticles& Particles) { FishingLineSolver::SolveDistanceConstraintsParallel(Particles, Iterations, BenchStiffness, 256); });
+
+        if (FishingLineSolver::IsISPCAvailable())
+        {
+            RunSolver(TEXT("ISPC red-black"), InitialPoints, NumFrames, GaussSeidelSeconds,
+                [Iterations](FFishingLineParticles& Particles) { FishingLineSolver::SolveDistanceConstraintsISPC(Particles, Iterations, BenchStiffness); });
+        }
+
+        FFishingLineSolverScratch Scratch;
+        for (int32 Passes = 1; Passes <= 2; ++Passes)
+        {
+            RunSolver(*FString::Printf(TEXT("Direct tridiagonal, %d pass(es)"), Passes), InitialPoints, NumFrames, GaussSeidelSeconds,
+                [&Scratch, Passes](FFishingLineParticles& Particles) { FishingLineSolver::SolveDistanceConstraintsDirect(Particles, Scratch, Passes); });
+        }
+
+        for (int32 XPBDIterations : { Iterations, FMath::Max(1, Iterations / 4) })
+        {
+            RunSolver(*FString::Printf(TEXT("XPBD, %d iteration(s)"), XPBDIterations), InitialPoints, NumFrames, GaussSeidelSeconds,
+                [&Scratch, XPBDIterations](FFishingLineParticles& Particles) { FishingLineSolver::SolveDistanceConstraintsXPBD(Particles, Scratch, XPBDIterations, BenchCompliance, BenchDeltaTime); });
+        }
+
+        RunMultigrid(NumFrames, Iterations);
+        RunParallel(NumFrames, Iterations);
+        RunIntegrate(InitialPoints, NumFrames);
+    }
+
+    static FAutoConsoleCommand BenchmarkCommand(
+        TEXT("Fishing.Line.Benchmark"),
+        TEXT("Times the fishing line solver on a synthetic line.\n")
+        TEXT("Usage: Fishing.Line.Benchmark [NumParticles=501] [NumFrames=300] [SolverIterations=10]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
+
+#endif // !UE_BUILD_SHIPPING
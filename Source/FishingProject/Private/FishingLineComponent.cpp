@@ -2,12 +2,80 @@
 
 #include "FishingLineComponent.h"
 #include "ProceduralMeshComponent.h"
+#include "FishingLineMeshComponent.h"
 #include "Materials/MaterialInterface.h"
 // #include "FishingBobber.h" // No longer needed here
 #include "FishingBobber.h"
 #include "FishingLogChannels.h"
+#include "FishingLineSolver.h"
+#include "FishingLineSubsystem.h"
+#include "FishingLinePhysicsCallback.h"
+#include "Algo/Reverse.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PBDRigidsSolver.h"
+
+DECLARE_CYCLE_STAT(TEXT("Collision Broadphase"), STAT_FishingLineCollisionBroadphase, STATGROUP_FishingLine);
+DECLARE_CYCLE_STAT(TEXT("Collision Narrowphase"), STAT_FishingLineCollisionNarrowphase, STATGROUP_FishingLine);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Collision Queries"), STAT_FishingLineCollisionQueries, STATGROUP_FishingLine);
+// Counters reset every frame: this is the sum of each colliding line's set, counted after any refresh.
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cached Collision Shapes (all lines)"), STAT_FishingLineCollisionShapes, STATGROUP_FishingLine);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Solver Steps"), STAT_FishingLineSolverSteps, STATGROUP_FishingLine);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Solver Sweeps"), STAT_FishingLineSolverSweeps, STATGROUP_FishingLine);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Solver Steps Converged Early"), STAT_FishingLineSolverEarlyOuts, STATGROUP_FishingLine);
 // #include "PrimitiveSceneProxy.h" // Keep if you were planning advanced rendering
 
+static TAutoConsoleVariable<int32> CVarFishingLineVectorIntegrate(
+    TEXT("r.Fishing.Line.VectorIntegrate"),
+    1,
+    TEXT("Integrate fishing line particles four at a time with vector registers.\n")
+    TEXT("0: Scalar per-particle integration\n")
+    TEXT("1: Vectorized integration (default)"),
+    ECVF_Default);
+
+/** Segments in each block of the parallel solve. A line at the default threshold (1024 particles) splits four ways. */
+static constexpr int32 ParallelSolveSegmentsPerTask = 256;
+/** Sweeps between convergence checks when iterations are adaptive. */
+static constexpr int32 AdaptiveCheckInterval = 4;
+/** Mesh sizes adaptive render rings pad to, between one ring per particle and RenderRingsPerSegment per segment. */
+static constexpr int32 AdaptiveRenderRingSizes = 8;
+
+static TAutoConsoleVariable<int32> CVarFishingLineISPCConstraints(
+    TEXT("r.Fishing.Line.ISPCConstraints"),
+    0,
+    TEXT("Project fishing line distance constraints with the ISPC kernel (red-black order). Ignored if the module was built without ISPC.\n")
+    TEXT("Red-black converges differently from the sequential sweep, so lines sag and stretch a little differently.\n")
+    TEXT("0: C++ Gauss-Seidel sweep (default)\n")
+    TEXT("1: ISPC red-black sweep"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFishingLineAllowSleep(
+    TEXT("r.Fishing.Line.AllowSleep"),
+    1,
+    TEXT("Let fishing lines with bAllowSleep stop simulating once they come to rest.\n")
+    TEXT("0: Always simulate\n")
+    TEXT("1: Sleep idle lines (default)"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFishingLineAsyncSimulation(
+    TEXT("r.Fishing.Line.AsyncSimulation"),
+    0,
+    TEXT("Where fishing lines step their simulation and build their mesh.\n")
+    TEXT("0: Synchronously in TickComponent (default)\n")
+    TEXT("1: In a task launched from TickComponent; the result is published on the next tick"),
+    ECVF_Default);
+
+/** With world collision on, the distance solve is split into this many passes, each followed by a contact projection. */
+static constexpr int32 CollisionSolvePasses = 2;
+
+/** How far an anchor (rod tip or attached end) may drift from where it was when the line fell asleep before the line wakes, in cm. */
+static constexpr float SleepWakeDistance = 0.1f;
+
+/** How far the rod tip may drift from the particles' SpaceOrigin before the solver space is re-centred on it. */
+static constexpr double SolverSpaceRebaseDistance = 100.0;
+
 // --- CONSTRUCTOR ---
 UFishingLineComponent::UFishingLineComponent()
 {
@@ -16,13 +84,54 @@ UFishingLineComponent::UFishingLineComponent()
 
     TargetCableLength = 100.0f; // Initial default, rod will override
     DesiredSegmentLength = 10.0f;
+    bUseAdaptiveResolution = false;
+    MaxSegmentLength = 60.0f;
+    AdaptiveBlendDistance = 200.0f;
     NumSegments = 0;
+    SolverType = EFishingLineSolverType::GaussSeidel;
     SolverIterations = 10;
+    bUseAdaptiveIterations = false;
+    SolverTolerance = 0.01f;
+    DirectSolverPasses = 2;
+    MultigridLevels = 2;
+    MultigridCoarseningFactor = 8;
+    MultigridCoarseIterations = 4;
+    ParallelSolveParticleThreshold = 1024;
     StiffnessFactor = 0.85f; // Made a bit stiffer by default
+    LineCompliance = 0.0001f;
+    bUseLongRangeAttachments = false;
     DampingFactor = 0.1f;  // Increased damping slightly
     CableGravityScale = 1.0f;
     DefaultParticleMass = 0.01f; // Made lighter by default
 
+    bUseFixedTimestep = true;
+    bSimulateInPhysicsThread = false;
+    FixedSimulationRate = 60.0f;
+    MaxSubstepsPerFrame = 4;
+    TimeAccumulator = 0.0f;
+    SimulatedCableLength = 0.0f;
+    FrameSolverIterations = 0;
+    FrameSolverResidual = 0.0f;
+
+    bEnableWorldCollision = false;
+    CollisionChannel = ECC_WorldDynamic;
+    ParticleCollisionRadius = 1.0f;
+    CollisionQueryMargin = 100.0f;
+    MaxCollisionShapes = 32;
+    CollisionQueryBounds = FBox(ForceInit);
+
+    bAllowSleep = true;
+    SleepSpeedThreshold = 1.0f;
+    SleepFrameCount = 30;
+    bIsSleeping = false;
+    SleepCandidateFrames = 0;
+    LastStartLocation = FVector::ZeroVector;
+    LastEndLocation = FVector::ZeroVector;
+
+    PublishedFrameResult = 0;
+    bHasPendingFrameResult = false;
+    PhysicsCallback = nullptr;
+
     bUseBezierInitialization = false;
     BezierSagMagnitude = 0.2f;
 
@@ -31,6 +140,12 @@ UFishingLineComponent::UFishingLineComponent()
     
     CableWidth = 2.0f;
     MeshTessellation = 4;
+    bUseDynamicMeshProxy = true;
+    RenderMode = EFishingLineRenderMode::Automatic;
+    RibbonDistance = 1000.0f;
+    RenderRingsPerSegment = 4;
+    bAdaptiveRenderRings = true;
+    RenderRingAngle = 10.0f;
     bSmoothNormals = true;
 
     FreeEndRelativeOffset = FVector(0,0,-100.0f); // Default free end hangs down a bit
@@ -48,7 +163,17 @@ UFishingLineComponent::UFishingLineComponent()
 void UFishingLineComponent::OnRegister()
 {
     Super::OnRegister();
-    if (!ProceduralMesh)
+    if (bUseDynamicMeshProxy)
+    {
+        if (!LineMesh)
+        {
+            LineMesh = NewObject<UFishingLineMeshComponent>(this, TEXT("CableLineMesh"));
+            LineMesh->SetupAttachment(this);
+            LineMesh->SetMaterial(0, CableMaterial);
+            LineMesh->RegisterComponent();
+        }
+    }
+    else if (!ProceduralMesh)
     {
         ProceduralMesh = NewObject<UProceduralMeshComponent>(this, TEXT("CableProceduralMesh"));
         ProceduralMesh->SetupAttachment(this);
@@ -59,11 +184,18 @@ void UFishingLineComponent::OnRegister()
 
 void UFishingLineComponent::OnUnregister()
 {
+    UnregisterPhysicsCallback();
+    WaitForAsyncSimulation();
     if (ProceduralMesh)
     {
         ProceduralMesh->DestroyComponent();
         ProceduralMesh = nullptr;
     }
+    if (LineMesh)
+    {
+        LineMesh->DestroyComponent();
+        LineMesh = nullptr;
+    }
     Super::OnUnregister();
 }
 
@@ -72,6 +204,15 @@ void UFishingLineComponent::BeginPlay()
     Super::BeginPlay();
     bRequiresParticleRebuild = true; // Force a rebuild on BeginPlay to use latest properties
 
+    if (UFishingLineSubsystem* LineSubsystem = GetWorld()->GetSubsystem<UFishingLineSubsystem>())
+    {
+        LineSubsystem->RegisterLine(this);
+    }
+    if (bSimulateInPhysicsThread)
+    {
+        RegisterPhysicsCallback();
+    }
+
     // REMOVED Bobber Spawning Logic from here
     // if (bAutoSpawnAndAttachBobber && BobberClassToSpawn)
     // {
@@ -85,11 +226,25 @@ void UFishingLineComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     // REMOVED Bobber Destruction Logic from here
     // DetachAndDestroyManagedBobber();
 
+    if (UFishingLineSubsystem* LineSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UFishingLineSubsystem>() : nullptr)
+    {
+        LineSubsystem->UnregisterLine(this);
+    }
+    UnregisterPhysicsCallback();
+    WaitForAsyncSimulation();
     Particles.Empty();
+    PreviousStepPositions.Empty();
+    InterpolatedPositions.Empty();
+    FrameResults[0] = FFishingLineFrameResult();
+    FrameResults[1] = FFishingLineFrameResult();
     if (ProceduralMesh)
     {
         ProceduralMesh->ClearAllMeshSections();
     }
+    if (LineMesh)
+    {
+        LineMesh->ClearMesh();
+    }
     Super::EndPlay(EndPlayReason);
 }
 
@@ -97,6 +252,39 @@ void UFishingLineComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+    if (IsSimulatedInPhysicsThread())
+    {
+        TickPhysicsThreadSimulation(DeltaTime);
+        return;
+    }
+
+    // A step launched last tick has to land before anything below touches the particles.
+    CompleteAsyncSimulation();
+
+    FFishingLineStepInputs Inputs;
+    if (!PrepareSimulation(DeltaTime, Inputs))
+    {
+        return;
+    }
+
+    FFishingLineFrameResult& BackResult = GetBackFrameResult();
+    if (CVarFishingLineAsyncSimulation.GetValueOnGameThread() != 0)
+    {
+        SimulationTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, Inputs, &BackResult]()
+        {
+            RunSimulation(Inputs, BackResult);
+        });
+        bHasPendingFrameResult = true;
+    }
+    else
+    {
+        RunSimulation(Inputs, BackResult);
+        PublishFrameResult();
+    }
+}
+
+bool UFishingLineComponent::PrepareSimulation(float DeltaTime, FFishingLineStepInputs& OutInputs)
+{
     if (bRequiresParticleRebuild)
     {
         UE_LOG(LogFishingSystemLine, Log, TEXT("UFishingLineComponent '%s': Tick - bRequiresParticleRebuild is TRUE. Calling RebuildParticles."), *GetName());
@@ -104,9 +292,14 @@ void UFishingLineComponent::TickComponent(float DeltaTime, ELevelTick TickType,
         // bRequiresParticleRebuild is set to false inside RebuildParticles upon successful completion
         if (Particles.Num() == 0 && TargetCableLength > 0) { // If rebuild failed to create particles but should have
              UE_LOG(LogFishingSystemLine, Error, TEXT("UFishingLineComponent '%s': Tick - RebuildParticles resulted in 0 particles despite TargetCableLength > 0. Line will not simulate."), *GetName());
-             return;
+             return false;
         }
     }
+    SpoolToTargetLength();
+    if (UpdateEndParticleState())
+    {
+        WakeLine();
+    }
     
     if (Particles.Num() < 2)
     {
@@ -114,22 +307,223 @@ void UFishingLineComponent::TickComponent(float DeltaTime, ELevelTick TickType,
         {
             ProceduralMesh->ClearMeshSection(0);
         }
+        if (LineMesh)
+        {
+            LineMesh->ClearMesh();
+        }
+        return false;
+    }
+
+    if (bIsSleeping)
+    {
+        if (CanSleep() && !HaveAnchorsMovedSinceSleep())
+        {
+            return false;
+        }
+        WakeLine();
+    }
+
+    UpdateCollisionCache();
+
+    const bool bEndAttached = GetResolvedAttachEndComponent() != nullptr;
+    OutInputs.DeltaTime = DeltaTime;
+    OutInputs.ComponentToWorld = GetComponentTransform();
+    OutInputs.StartLocation = GetStartTransform().GetLocation();
+    OutInputs.EndLocation = bEndAttached ? GetAttachedEndPointTransform().GetLocation() : FVector::ZeroVector;
+    OutInputs.bEndAttached = bEndAttached;
+    OutInputs.Gravity = FVector(0, 0, GetWorld()->GetGravityZ() * CableGravityScale);
+    OutInputs.bVectorIntegrate = CVarFishingLineVectorIntegrate.GetValueOnGameThread() != 0;
+    OutInputs.bISPCConstraints = CVarFishingLineISPCConstraints.GetValueOnGameThread() != 0 && FishingLineSolver::IsISPCAvailable();
+    OutInputs.bWorldCollision = bEnableWorldCollision && CollisionShapes.Num() > 0;
+    OutInputs.ParticleCollisionRadius = ParticleCollisionRadius;
+
+    // Last frame's views are the best guess at this frame's; BuildCableMesh may run before this frame's are known.
+    OutInputs.bHasViewLocation = false;
+    double ClosestViewDistSq = TNumericLimits<double>::Max();
+    for (const FVector& ViewLocation : GetWorld()->ViewLocationsRenderedLastFrame)
+    {
+        const double DistSq = FVector::DistSquared(ViewLocation, OutInputs.StartLocation);
+        if (DistSq < ClosestViewDistSq)
+        {
+            ClosestViewDistSq = DistSq;
+            OutInputs.ViewLocation = ViewLocation;
+            OutInputs.bHasViewLocation = true;
+        }
+    }
+    OutInputs.PreviousRenderRings = FrameResults[PublishedFrameResult].Mesh.TopologyRings;
+    return true;
+}
+
+void UFishingLineComponent::UpdateCollisionCache()
+{
+    if (!bEnableWorldCollision)
+    {
+        CollisionShapes.Reset();
+        CollisionQueryBounds = FBox(ForceInit);
+        return;
+    }
+
+    FBox LineBounds(ForceInit);
+    for (const FVector3f& Position : Particles.Positions)
+    {
+        LineBounds += Particles.ToWorld(Position);
+    }
+    LineBounds = LineBounds.ExpandBy(ParticleCollisionRadius);
+
+    // The cached set stays valid until the line leaves the region it was gathered for.
+    if (CollisionQueryBounds.IsValid && CollisionQueryBounds.IsInside(LineBounds))
+    {
+        INC_DWORD_STAT_BY(STAT_FishingLineCollisionShapes, CollisionShapes.Num());
         return;
     }
 
-    SimulateCable(DeltaTime);
-    SolveConstraints(DeltaTime);
-    UpdateCableMesh();
+    SCOPE_CYCLE_COUNTER(STAT_FishingLineCollisionBroadphase);
+    INC_DWORD_STAT(STAT_FishingLineCollisionQueries);
+
+    CollisionQueryBounds = LineBounds.ExpandBy(CollisionQueryMargin);
+    CollisionShapes.Reset();
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(FishingLineCollision), false, GetOwner());
+    if (GetOwner() && GetOwner()->GetOwner())
+    {
+        QueryParams.AddIgnoredActor(GetOwner()->GetOwner()); // Whoever holds the rod
+    }
+    if (USceneComponent* ResolvedEndComp = GetResolvedAttachEndComponent())
+    {
+        QueryParams.AddIgnoredActor(ResolvedEndComp->GetOwner());
+    }
+
+    TArray<FOverlapResult> Overlaps;
+    GetWorld()->OverlapMultiByChannel(Overlaps, CollisionQueryBounds.GetCenter(), FQuat::Identity, CollisionChannel,
+        FCollisionShape::MakeBox(CollisionQueryBounds.GetExtent()), QueryParams);
+
+    const FVector Inflation(ParticleCollisionRadius);
+    auto AddShape = [this, &Inflation](FFishingLineCollisionShape::EShapeType Type, const FTransform& ShapeTM, const FVector& Extents, const FBox& LocalBounds)
+    {
+        if (CollisionShapes.Num() >= MaxCollisionShapes) return;
+        FFishingLineCollisionShape& Shape = CollisionShapes.AddDefaulted_GetRef();
+        Shape.Type = Type;
+        Shape.Center = ShapeTM.GetLocation();
+        Shape.Rotation = ShapeTM.GetRotation();
+        Shape.Extents = Extents;
+        Shape.Bounds = LocalBounds.TransformBy(FTransform(ShapeTM.GetRotation(), ShapeTM.GetLocation())).ExpandBy(Inflation);
+    };
+
+    for (const FOverlapResult& Overlap : Overlaps)
+    {
+        // Only blocking, non-movable geometry is cached: anything that moves would invalidate the cache every frame.
+        UPrimitiveComponent* Primitive = Overlap.GetComponent();
+        if (!Overlap.bBlockingHit || !Primitive || Primitive->Mobility == EComponentMobility::Movable) continue;
+
+        UBodySetup* BodySetup = Primitive->GetBodySetup();
+        if (!BodySetup) continue;
+
+        const FTransform PrimitiveTM = Primitive->GetComponentTransform();
+        const FVector Scale = PrimitiveTM.GetScale3D().GetAbs();
+        const FKAggregateGeom& Geometry = BodySetup->AggGeom;
+
+        for (const FKSphereElem& Sphere : Geometry.SphereElems)
+        {
+            const float Radius = Sphere.Radius * Scale.GetMax();
+            AddShape(FFishingLineCollisionShape::Shape_Sphere, FTransform(PrimitiveTM.TransformPosition(Sphere.Center)),
+                FVector(Radius, Radius, 0.0f), FBox(FVector(-Radius), FVector(Radius)));
+        }
+        for (const FKBoxElem& Box : Geometry.BoxElems)
+        {
+            const FTransform BoxTM = FTransform(Box.Rotation, Box.Center) * PrimitiveTM;
+            const FVector HalfExtents = FVector(Box.X, Box.Y, Box.Z) * 0.5f * Scale;
+            AddShape(FFishingLineCollisionShape::Shape_Box, BoxTM, HalfExtents, FBox(-HalfExtents, HalfExtents));
+        }
+        for (const FKSphylElem& Capsule : Geometry.SphylElems)
+        {
+            const FTransform CapsuleTM = FTransform(Capsule.Rotation, Capsule.Center) * PrimitiveTM;
+            const float Radius = Capsule.Radius * FMath::Max(Scale.X, Scale.Y);
+            const float HalfHeight = Capsule.Length * 0.5f * Scale.Z;
+            AddShape(FFishingLineCollisionShape::Shape_Capsule, CapsuleTM, FVector(Radius, Radius, HalfHeight),
+                FBox(FVector(-Radius, -Radius, -HalfHeight - Radius), FVector(Radius, Radius, HalfHeight + Radius)));
+        }
+        // Convex hulls are approximated by their local bounding box.
+        for (const FKConvexElem& Convex : Geometry.ConvexElems)
+        {
+            const FTransform ConvexTM = FTransform(PrimitiveTM.GetRotation(), PrimitiveTM.TransformPosition(Convex.ElemBox.GetCenter()));
+            const FVector HalfExtents = Convex.ElemBox.GetExtent() * Scale;
+            AddShape(FFishingLineCollisionShape::Shape_Box, ConvexTM, HalfExtents, FBox(-HalfExtents, HalfExtents));
+        }
+    }
+
+    INC_DWORD_STAT_BY(STAT_FishingLineCollisionShapes, CollisionShapes.Num());
+    UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': UpdateCollisionCache - %d overlaps, %d shapes cached (max %d)."),
+        *GetName(), Overlaps.Num(), CollisionShapes.Num(), MaxCollisionShapes);
+}
+
+void UFishingLineComponent::RunSimulation(const FFishingLineStepInputs& Inputs, FFishingLineFrameResult& OutResult)
+{
+    AdvanceSimulation(Inputs, bUseFixedTimestep);
+
+    OutResult.Positions = GetSimulatedRenderPositions();
+    OutResult.DeltaTime = Inputs.DeltaTime;
+    OutResult.SolverIterations = FrameSolverIterations;
+    OutResult.SolverResidual = FrameSolverResidual;
+    BuildCableMesh(OutResult.Positions, Inputs, OutResult.Mesh);
+}
+
+void UFishingLineComponent::AdvanceSimulation(const FFishingLineStepInputs& Inputs, bool bFixedTimestep, float AnchorAlpha)
+{
+    if (FVector::DistSquared(Inputs.StartLocation, Particles.SpaceOrigin) > FMath::Square(SolverSpaceRebaseDistance))
+    {
+        RebaseSolverSpace(Inputs.StartLocation);
+    }
+
+    FrameSolverIterations = 0;
+    FrameSolverResidual = 0.0f;
+    if (bFixedTimestep)
+    {
+        StepFixedTimestep(Inputs);
+    }
+    else
+    {
+        SimulateCable(Inputs, Inputs.DeltaTime, AnchorAlpha);
+        SolveConstraints(Inputs, Inputs.DeltaTime);
+        UpdateInterpolatedPositions(Inputs, 1.0f);
+    }
+}
+
+void UFishingLineComponent::PublishFrameResult()
+{
+    PublishedFrameResult = 1 - PublishedFrameResult;
+    const FFishingLineFrameResult& Result = FrameResults[PublishedFrameResult];
+    ApplyCableMesh(Result.Mesh);
+    UpdateSleepState(Result.DeltaTime);
+}
+
+void UFishingLineComponent::CompleteAsyncSimulation()
+{
+    if (bHasPendingFrameResult)
+    {
+        SimulationTask.Wait();
+        bHasPendingFrameResult = false;
+        PublishFrameResult();
+    }
+}
+
+void UFishingLineComponent::WaitForAsyncSimulation()
+{
+    if (bHasPendingFrameResult)
+    {
+        SimulationTask.Wait();
+        bHasPendingFrameResult = false;
+    }
 }
 
 FBoxSphereBounds UFishingLineComponent::CalcBounds(const FTransform& LocalToWorld) const
 {
-    if (Particles.Num() > 0)
+    const TArray<FVector>& Positions = GetRenderPositions();
+    if (Positions.Num() > 0)
     {
         FBox Box(ForceInit);
-        for (const FVerletPoint& Particle : Particles)
+        for (const FVector& Position : Positions)
         {
-            Box += Particle.Position;
+            Box += Position;
         }
         FBox LocalBox = Box.TransformBy(LocalToWorld.Inverse());
         return FBoxSphereBounds(LocalBox);
@@ -137,6 +531,119 @@ FBoxSphereBounds UFishingLineComponent::CalcBounds(const FTransform& LocalToWorl
     return FBoxSphereBounds(FSphere(FVector::ZeroVector, CableWidth)).TransformBy(LocalToWorld);
 }
 
+// --- PHYSICS-THREAD SIMULATION ---
+
+void UFishingLineComponent::RegisterPhysicsCallback()
+{
+    FPhysScene* PhysScene = GetWorld() ? GetWorld()->GetPhysicsScene() : nullptr;
+    Chaos::FPhysicsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr;
+    if (!Solver)
+    {
+        UE_LOG(LogFishingSystemLine, Warning, TEXT("UFishingLineComponent '%s': bSimulateInPhysicsThread is set but the world has no physics solver. Simulating on the game thread."), *GetName());
+        return;
+    }
+
+    if (bUseFixedTimestep)
+    {
+        UE_LOG(LogFishingSystemLine, Warning, TEXT("UFishingLineComponent '%s': bUseFixedTimestep is ignored while bSimulateInPhysicsThread is set; the line steps once per physics step."), *GetName());
+    }
+
+    PhysicsCallback = Solver->CreateAndRegisterSimCallbackObject_External<FFishingLinePhysicsCallback>();
+    PhysicsCallback->Line = this;
+    UE_LOG(LogFishingSystemLine, Log, TEXT("UFishingLineComponent '%s': Simulating in the physics thread."), *GetName());
+}
+
+void UFishingLineComponent::UnregisterPhysicsCallback()
+{
+    if (!PhysicsCallback)
+    {
+        return;
+    }
+
+    WatchEndBody(nullptr);
+    {
+        FScopeLock Lock(&PhysicsCallback->LineLock);
+        PhysicsCallback->Line = nullptr;
+        PhysicsCallback->EndBodyProxy = nullptr;
+    }
+    FPhysScene* PhysScene = GetWorld() ? GetWorld()->GetPhysicsScene() : nullptr;
+    if (Chaos::FPhysicsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr)
+    {
+        Solver->UnregisterAndFreeSimCallbackObject_External(PhysicsCallback);
+    }
+    PhysicsCallback = nullptr;
+}
+
+void UFishingLineComponent::TickPhysicsThreadSimulation(float DeltaTime)
+{
+    // Several physics steps may have finished since the last frame; only the newest is rendered. Popped outputs belong to
+    // the game thread, so they are meshed without LineLock and the physics steps never wait on the mesher.
+    Chaos::TSimCallbackOutputHandle<FFishingLinePhysicsOutput> Latest;
+    while (Chaos::TSimCallbackOutputHandle<FFishingLinePhysicsOutput> Output = PhysicsCallback->PopOutputData_External())
+    {
+        Latest = MoveTemp(Output);
+    }
+    if (Latest)
+    {
+        FFishingLineFrameResult& BackResult = GetBackFrameResult();
+        BackResult.Positions = Latest->Positions;
+        BackResult.DeltaTime = DeltaTime;
+        BackResult.SolverIterations = Latest->SolverIterations;
+        BackResult.SolverResidual = Latest->SolverResidual;
+        BuildCableMesh(BackResult.Positions, Latest->StepInputs, BackResult.Mesh);
+    }
+
+    // Publishing reads the particles for the sleep check, and preparing may respool them: both under the lock.
+    FScopeLock Lock(&PhysicsCallback->LineLock);
+    if (Latest)
+    {
+        PublishFrameResult();
+    }
+
+    FFishingLinePhysicsInput* Input = PhysicsCallback->GetProducerInputData_External();
+    Input->bSimulate = PrepareSimulation(DeltaTime, Input->StepInputs);
+    Input->Serial = ++PhysicsCallback->ProducedInputSerial;
+
+    // A pinned end on a simulating body is read from the body itself on every physics step. The handle is looked up
+    // again every frame, so a body recreated under the same component is picked up on the next one.
+    UPrimitiveComponent* EndBody = nullptr;
+    if (Input->bSimulate && Input->StepInputs.bEndAttached && Particles.IsFixed(0) && EndAttachmentSocketName == NAME_None)
+    {
+        if (UPrimitiveComponent* EndPrimitive = Cast<UPrimitiveComponent>(GetResolvedAttachEndComponent()); EndPrimitive && EndPrimitive->IsSimulatingPhysics())
+        {
+            EndBody = EndPrimitive;
+        }
+    }
+    PhysicsCallback->EndBodyProxy = EndBody ? EndBody->GetBodyInstance()->GetPhysicsActorHandle() : nullptr;
+    WatchEndBody(EndBody);
+}
+
+void UFishingLineComponent::WatchEndBody(UPrimitiveComponent* EndBody)
+{
+    if (WatchedEndBody.Get() == EndBody) return;
+
+    if (UPrimitiveComponent* Previous = WatchedEndBody.Get())
+    {
+        Previous->OnComponentPhysicsStateChanged.RemoveDynamic(this, &UFishingLineComponent::OnEndBodyPhysicsStateChanged);
+    }
+    WatchedEndBody = EndBody;
+    if (EndBody)
+    {
+        EndBody->OnComponentPhysicsStateChanged.AddUniqueDynamic(this, &UFishingLineComponent::OnEndBodyPhysicsStateChanged);
+    }
+}
+
+void UFishingLineComponent::OnEndBodyPhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange)
+{
+    // The proxy is freed on the physics thread after this; no step may read it from here on. A recreated body gets
+    // its new handle on the next TickPhysicsThreadSimulation.
+    if (StateChange == EComponentPhysicsStateChange::Destroyed && PhysicsCallback)
+    {
+        FScopeLock Lock(&PhysicsCallback->LineLock);
+        PhysicsCallback->EndBodyProxy = nullptr;
+    }
+}
+
 // --- PUBLIC API ---
 // REMOVED: void UFishingLineComponent::SetAttachEndTo(...) - Use AttachCableEndTo
 
@@ -146,24 +653,34 @@ void UFishingLineComponent::SetCableLength(float Length)
     float MinPracticalLength = FMath::Max(DesiredSegmentLength * 0.5f, 1.0f);
     float NewLength = FMath::Max(Length, MinPracticalLength);
 
-    if (!FMath::IsNearlyEqual(TargetCableLength, NewLength, 0.1f) || (Particles.Num() == 0 && NewLength > 0))
+    if (!FMath::IsNearlyEqual(TargetCableLength, NewLength) || (Particles.Num() == 0 && NewLength > 0))
     {
-        UE_LOG(LogFishingSystemLine, Log, TEXT("UFishingLineComponent '%s': SetCableLength changing TargetCableLength from %.1f to %.1f. Setting bRequiresParticleRebuild=true."),
+        UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': SetCableLength changing TargetCableLength from %.1f to %.1f."),
             *GetName(), TargetCableLength, NewLength);
         TargetCableLength = NewLength;
-        bRequiresParticleRebuild = true;
+        // An existing line is reeled in or paid out at the tip on the next tick (SpoolToTargetLength); only an empty one is rebuilt.
+        if (Particles.Num() < 2)
+        {
+            bRequiresParticleRebuild = true;
+        }
     }
 }
 
-TArray<FVector> UFishingLineComponent::GetParticleLocations() const
+void UFishingLineComponent::WakeLine()
 {
-    TArray<FVector> Locations;
-    Locations.Reserve(Particles.Num());
-    for (const FVerletPoint& Particle : Particles)
+    if (bIsSleeping)
     {
-        Locations.Add(Particle.Position);
+        UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': Waking up."), *GetName());
+        // Time that passed while asleep is not owed to the simulation.
+        TimeAccumulator = 0.0f;
     }
-    return Locations;
+    bIsSleeping = false;
+    SleepCandidateFrames = 0;
+}
+
+TArray<FVector> UFishingLineComponent::GetParticleLocations() const
+{
+    return GetRenderPositions();
 }
 
 void UFishingLineComponent::AttachCableEndTo(USceneComponent* NewEndAttachment, FName NewSocketName)
@@ -176,8 +693,19 @@ void UFishingLineComponent::AttachCableEndTo(USceneComponent* NewEndAttachment,
     {
         EndAttachmentComponent = NewEndAttachment;
         EndAttachmentSocketName = NewSocketName;
-        bRequiresParticleRebuild = true;
-        UE_LOG(LogFishingSystemLine, Log, TEXT("UFishingLineComponent '%s': Attachment changed. bRequiresParticleRebuild=true."), *GetName());
+        // Physics steps still running on the old inputs use their end location, not the old body.
+        if (PhysicsCallback)
+        {
+            FScopeLock Lock(&PhysicsCallback->LineLock);
+            PhysicsCallback->EndBodyProxy = nullptr;
+        }
+        // The particles carry over; UpdateEndParticleState re-pins or frees the end on the next tick.
+        if (Particles.Num() < 2)
+        {
+            bRequiresParticleRebuild = true;
+        }
+        UE_LOG(LogFishingSystemLine, Log, TEXT("UFishingLineComponent '%s': Attachment changed. bRequiresParticleRebuild=%s."),
+            *GetName(), bRequiresParticleRebuild ? TEXT("true") : TEXT("false"));
     } else {
         UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': AttachCableEndTo - No change in attachment. Skipping rebuild trigger."), *GetName());
     }
@@ -228,19 +756,34 @@ void UFishingLineComponent::RebuildParticles()
     {
         UE_LOG(LogFishingSystemLine, Error, TEXT("UFishingLineComponent '%s': RebuildParticles - DesiredSegmentLength is <= 0 (%.2f). Cannot rebuild."), *GetName(), DesiredSegmentLength);
         Particles.Empty();
+        FrameResults[PublishedFrameResult].Positions.Reset();
         bRequiresParticleRebuild = false;
         return;
     }
 
-    const int32 NewNumSegments = FMath::Max(1, FMath::CeilToInt(TargetCableLength / DesiredSegmentLength));
+    TArray<float> SegmentRestLengths;
+    ComputeSegmentRestLengths(SegmentRestLengths);
+    const int32 NewNumSegments = SegmentRestLengths.Num();
     NumSegments = NewNumSegments;
     const int32 NumPoints = NumSegments + 1;
 
-    UE_LOG(LogFishingSystemLine, Log, TEXT("UFishingLineComponent '%s': RebuildParticles - TargetCableLength=%.1f, DesiredSegmentLength=%.1f -> NewNumSegments=%d, NumPoints=%d"),
-        *GetName(), TargetCableLength, DesiredSegmentLength, NewNumSegments, NumPoints);
+    UE_LOG(LogFishingSystemLine, Log, TEXT("UFishingLineComponent '%s': RebuildParticles - TargetCableLength=%.1f, DesiredSegmentLength=%.1f, Adaptive=%s -> NewNumSegments=%d, NumPoints=%d"),
+        *GetName(), TargetCableLength, DesiredSegmentLength, bUseAdaptiveResolution ? TEXT("TRUE") : TEXT("FALSE"), NewNumSegments, NumPoints);
 
     Particles.Reset(NumPoints);
 
+    // Particles are laid out by their rest distance along the line, so uneven segments start out uneven too.
+    TArray<float> CurveParams;
+    CurveParams.Reserve(NumPoints);
+    CurveParams.Add(0.0f);
+    double DistanceAlongLine = 0.0;
+    for (const float RestLength : SegmentRestLengths)
+    {
+        DistanceAlongLine += RestLength;
+        CurveParams.Add(float(DistanceAlongLine / FMath::Max(TargetCableLength, KINDA_SMALL_NUMBER)));
+    }
+    CurveParams.Last() = 1.0f;
+
     FTransform StartTM_World = GetStartTransform();
     USceneComponent* ResolvedEndComp = GetResolvedAttachEndComponent();
     FTransform EndTM_World = ResolvedEndComp ? GetAttachedEndPointTransform() : GetFreeEndPointTransform();
@@ -251,27 +794,30 @@ void UFishingLineComponent::RebuildParticles()
     UE_LOG(LogFishingSystemLine, Log, TEXT("UFishingLineComponent '%s': RebuildParticles - StartPos: %s, TargetEndPos: %s. ResolvedEndComp: %s"),
         *GetName(), *P0_World.ToString(), *P3_World_Target.ToString(), ResolvedEndComp ? *ResolvedEndComp->GetName() : TEXT("NULL"));
 
+    // Solver space is centred on the rod tip before any particle is added, so AddPoint converts relative to it.
+    Particles.SpaceOrigin = P0_World;
+
     TArray<FVector> InitialWorldPositions;
     InitialWorldPositions.Reserve(NumPoints);
 
     if (bUseBezierInitialization && NumPoints >= 2)
     {
-        GeneratePointsOnBezier(InitialWorldPositions, P0_World, P3_World_Target, NumPoints);
+        GeneratePointsOnBezier(InitialWorldPositions, P0_World, P3_World_Target, CurveParams);
         UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': RebuildParticles - Used Bezier initialization for %d points."), *GetName(), NumPoints);
     }
     else
     {
         for (int32 i = 0; i < NumPoints; ++i)
         {
-            float Alpha = (NumPoints > 1) ? (float)i / (float)(NumPoints - 1) : 0.0f;
-            InitialWorldPositions.Add(FMath::Lerp(P0_World, P3_World_Target, Alpha));
+            InitialWorldPositions.Add(FMath::Lerp(P0_World, P3_World_Target, CurveParams[i]));
         }
         UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': RebuildParticles - Used Linear interpolation for %d points."), *GetName(), NumPoints);
     }
     
-    for (int32 i = 0; i < NumPoints; ++i)
+    // Laid out from the rod tip (i == 0) as above, but added end first: see Particles.
+    for (int32 i = NumPoints - 1; i >= 0; --i)
     {
-        float CurrentParticleMass = DefaultParticleMass;
+        float CurrentParticleMass = ComputeParticleMass(SegmentRestLengths, i);
         FVerletPoint NewPoint(InitialWorldPositions[i], CurrentParticleMass);
         NewPoint.bIsFixed = false; 
 
@@ -282,85 +828,305 @@ void UFishingLineComponent::RebuildParticles()
         }
         else if (i == NumPoints - 1 && ResolvedEndComp) // Last particle AND attached
         {
-            // The last particle is NOT fixed if attached to a dangling bobber (whose physics is off).
-            // It IS fixed if attached to something with its own active physics.
-            NewPoint.bIsFixed = false; // Assume not fixed initially for dangling case
-            AFishingBobber* AttachedBobber = ResolvedEndComp->GetOwner() ? Cast<AFishingBobber>(ResolvedEndComp->GetOwner()) : nullptr;
-            if (AttachedBobber && AttachedBobber->GetCurrentBobberState() == EBobberState::DanglingAtTip)
-            {
-                // It's a dangling bobber, so line particle is NOT fixed.
-                UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': RebuildParticles - Point %d (End Attached to Dangling Bobber) set to NOT FIXED."), *GetName(), i);
-            }
-            else if (AttachedBobber) // Bobber in another state (e.g. Flying)
-            {
-                 NewPoint.bIsFixed = true; // Bobber might be driving its own position
-                 UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': RebuildParticles - Point %d (End Attached to Bobber in state %s) set to FIXED."), *GetName(), i, *UEnum::GetValueAsString(AttachedBobber->GetCurrentBobberState()));
-            }
-            else // Attached to something else that isn't a bobber
-            {
-                 NewPoint.bIsFixed = true; // Assume other attachments are fixed targets
-                 UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': RebuildParticles - Point %d (End Attached to Non-Bobber %s) set to FIXED."), *GetName(), i, *ResolvedEndComp->GetName());
-            }
-            
+            NewPoint.bIsFixed = ShouldFixAttachedEnd(ResolvedEndComp);
             NewPoint.Mass = DefaultParticleMass * FMath::Max(1.0f, AttachedEndMassMultiplier);
             UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': RebuildParticles - Point %d (End Attached) mass set to %.4f. IsFixed: %s"),
                    *GetName(), i, NewPoint.Mass, NewPoint.bIsFixed ? TEXT("TRUE") : TEXT("FALSE"));
         }
-        Particles.Add(NewPoint);
+        Particles.AddPoint(NewPoint);
     }
+    Algo::Reverse(SegmentRestLengths);
+    Particles.RestLengths = MoveTemp(SegmentRestLengths);
+    SimulatedCableLength = TargetCableLength;
     
+    const int32 TipIndex = GetTipIndex();
     if (Particles.Num() > 0)
     {
-        Particles[0].Position = P0_World;
-        Particles[0].OldPosition = P0_World;
+        Particles.Positions[TipIndex] = FVector3f::ZeroVector;
+        Particles.OldPositions[TipIndex] = FVector3f::ZeroVector;
     }
 
     // Snap the last particle's initial position only if it's truly fixed to a target that dictates its position
-    if (Particles.Num() > 1 && Particles.Last().bIsFixed && ResolvedEndComp)
+    const int32 LastIndex = 0;
+    if (Particles.Num() > 1 && Particles.IsFixed(LastIndex) && ResolvedEndComp)
     {
         UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': RebuildParticles - Snapping Last Particle (%d) to %s (TargetEndPos) because it's marked as bIsFixed."),
-           *GetName(), Particles.Num() - 1, *P3_World_Target.ToString());
-        Particles.Last().Position = P3_World_Target;
-        Particles.Last().OldPosition = P3_World_Target;
+           *GetName(), LastIndex, *P3_World_Target.ToString());
+        Particles.Positions[LastIndex] = Particles.ToLocal(P3_World_Target);
+        Particles.OldPositions[LastIndex] = Particles.Positions[LastIndex];
     }
-    else if (Particles.Num() > 1 && !Particles.Last().bIsFixed && ResolvedEndComp)
+    else if (Particles.Num() > 1 && !Particles.IsFixed(LastIndex) && ResolvedEndComp)
     {
         // If the last particle is not fixed (e.g., attached to a dangling bobber),
         // initialize its position, but it will be free to move during simulation.
         // P3_World_Target is still a good initial guess from the Lerp/Bezier.
         UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': RebuildParticles - Initializing Last Particle (%d) to %s. It is NOT fixed and will simulate."),
-           *GetName(), Particles.Num()-1, *Particles.Last().Position.ToString()); // Use its already set InitialWorldPosition
+           *GetName(), LastIndex, *Particles.GetWorldPosition(LastIndex).ToString()); // Use its already set InitialWorldPosition
         // No need to reset OldPosition if we want it to start from rest from its initial calculated position
-        Particles.Last().OldPosition = Particles.Last().Position;
+        Particles.OldPositions[LastIndex] = Particles.Positions[LastIndex];
     }
 
 
+    WakeLine();
+
+    // A rebuilt line starts at rest, so there is nothing to interpolate from yet.
+    PreviousStepPositions = Particles.Positions;
+    InterpolatedPositions.SetNumUninitialized(Particles.Num());
+    for (int32 i = 0; i < Particles.Num(); ++i)
+    {
+        InterpolatedPositions[i] = Particles.GetWorldPosition(TipIndex - i);
+    }
+    FrameResults[PublishedFrameResult].Positions = InterpolatedPositions;
+    TimeAccumulator = 0.0f;
+
     bRequiresParticleRebuild = false;
     UE_LOG(LogFishingSystemLine, Log, TEXT("UFishingLineComponent '%s': RebuildParticles END. New Particle Count: %d. bRequiresParticleRebuild is now false."), *GetName(), Particles.Num());
 }
 
-void UFishingLineComponent::SimulateCable(float DeltaTime)
+void UFishingLineComponent::ComputeSegmentRestLengths(TArray<float>& OutRestLengths) const
+{
+    OutRestLengths.Reset();
+
+    // Lines too short to have a middle section just use the end length throughout.
+    if (!bUseAdaptiveResolution || TargetCableLength <= 2.0f * DesiredSegmentLength)
+    {
+        const int32 NumUniformSegments = FMath::Max(1, FMath::CeilToInt(TargetCableLength / DesiredSegmentLength));
+        OutRestLengths.Init(TargetCableLength / NumUniformSegments, NumUniformSegments);
+        return;
+    }
+
+    // Greedy walk from the rod tip, sampling the length function at the segment's midpoint.
+    double Covered = 0.0;
+    while (Covered < TargetCableLength)
+    {
+        const float Guess = GetAdaptiveSegmentLength(Covered);
+        const float RestLength = GetAdaptiveSegmentLength(Covered + 0.5 * Guess);
+        OutRestLengths.Add(RestLength);
+        Covered += RestLength;
+    }
+
+    // The last segment overshoots the line's end. Trim it, and fold it into its neighbour if that leaves a sliver.
+    const float Overshoot = float(Covered - TargetCableLength);
+    OutRestLengths.Last() -= Overshoot;
+    if (OutRestLengths.Num() > 1 && OutRestLengths.Last() < 0.5f * DesiredSegmentLength)
+    {
+        const float Sliver = OutRestLengths.Pop();
+        OutRestLengths.Last() += Sliver;
+    }
+}
+
+float UFishingLineComponent::GetAdaptiveSegmentLength(double DistanceAlongLine) const
+{
+    // DesiredSegmentLength at both ends, easing into MaxSegmentLength over AdaptiveBlendDistance.
+    const double DistanceToNearestEnd = FMath::Max(0.0, FMath::Min(DistanceAlongLine, double(TargetCableLength) - DistanceAlongLine));
+    const float Blend = FMath::SmoothStep(0.0f, FMath::Max(AdaptiveBlendDistance, 1.0f), float(DistanceToNearestEnd));
+    return FMath::Lerp(DesiredSegmentLength, FMath::Max(MaxSegmentLength, DesiredSegmentLength), Blend);
+}
+
+float UFishingLineComponent::ComputeParticleMass(const TArray<float>& SegmentRestLengths, int32 Index) const
+{
+    if (!bUseAdaptiveResolution)
+    {
+        return DefaultParticleMass;
+    }
+    // A particle stands for half of each neighbouring segment; scale so the line keeps its mass per length.
+    const float RepresentedLength = 0.5f * ((Index > 0 ? SegmentRestLengths[Index - 1] : 0.0f) + (Index < SegmentRestLengths.Num() ? SegmentRestLengths[Index] : 0.0f));
+    return DefaultParticleMass * FMath::Max(RepresentedLength / DesiredSegmentLength, 0.5f);
+}
+
+void UFishingLineComponent::RefreshParticleMass(int32 Index)
+{
+    // The end particle's mass is owned by RebuildParticles and UpdateEndParticleState (AttachedEndMassMultiplier).
+    if (Index > 0 && Index < Particles.Num() - 1)
+    {
+        Particles.SetMass(Index, ComputeParticleMass(Particles.RestLengths, Index));
+    }
+}
+
+bool UFishingLineComponent::ShouldFixAttachedEnd(const USceneComponent* EndComponent) const
+{
+    if (!EndComponent)
+    {
+        return false;
+    }
+    // A dangling bobber has its physics off and follows the line's last particle, so that particle simulates.
+    // A bobber in any other state (e.g. Flying) drives its own position, as does anything that is not a bobber.
+    const AFishingBobber* AttachedBobber = Cast<AFishingBobber>(EndComponent->GetOwner());
+    return !AttachedBobber || AttachedBobber->GetCurrentBobberState() != EBobberState::DanglingAtTip;
+}
+
+bool UFishingLineComponent::UpdateEndParticleState()
+{
+    if (Particles.Num() < 2)
+    {
+        return false;
+    }
+
+    const int32 LastIndex = 0;
+    const USceneComponent* ResolvedEndComp = GetResolvedAttachEndComponent();
+    const bool bShouldBeFixed = ShouldFixAttachedEnd(ResolvedEndComp);
+    const float Mass = ResolvedEndComp ? DefaultParticleMass * FMath::Max(1.0f, AttachedEndMassMultiplier) : ComputeParticleMass(Particles.RestLengths, LastIndex);
+    if (Particles.IsFixed(LastIndex) == bShouldBeFixed && FMath::IsNearlyEqual(Particles.GetMass(LastIndex), Mass))
+    {
+        return false;
+    }
+
+    // Position and OldPosition are left alone: a newly pinned end is snapped to its attachment by SimulateCable, and a
+    // newly freed one carries on from wherever it was pinned.
+    Particles.SetFixed(LastIndex, bShouldBeFixed);
+    Particles.SetMass(LastIndex, Mass);
+    UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': End particle %d warm-started. IsFixed: %s, Mass: %.4f, Attached to: %s"),
+        *GetName(), LastIndex, bShouldBeFixed ? TEXT("TRUE") : TEXT("FALSE"), Mass, ResolvedEndComp ? *ResolvedEndComp->GetName() : TEXT("NULL"));
+    return true;
+}
+
+void UFishingLineComponent::SpoolToTargetLength()
+{
+    if (Particles.Num() < 2 || FMath::IsNearlyEqual(SimulatedCableLength, TargetCableLength))
+    {
+        return;
+    }
+
+    // The rod tip is the spool: all of the length change goes into the tip segment, and particles are wound on or paid
+    // off there. Everything past the tip keeps its position and velocity. The tip is the last particle, so this only
+    // ever moves the tip's own entries in the arrays, however long the line is.
+    TArray<float>& RestLengths = Particles.RestLengths;
+    const float TipSegmentLength = DesiredSegmentLength;
+    RestLengths.Last() += TargetCableLength - SimulatedCableLength;
+    SimulatedCableLength = TargetCableLength;
+    WakeLine();
+
+    // Reeling in: wind on particles until the tip segment is long enough again. The end particle always stays.
+    int32 NumToRemove = 0;
+    float TipRestLength = RestLengths.Last();
+    while (TipRestLength < 0.5f * TipSegmentLength && NumToRemove + 2 < Particles.Num())
+    {
+        ++NumToRemove;
+        TipRestLength += RestLengths[RestLengths.Num() - 1 - NumToRemove];
+    }
+    if (NumToRemove > 0)
+    {
+        RemoveParticleRange(GetTipIndex() - NumToRemove, NumToRemove);
+    }
+
+    // Paying out: split whole TipSegmentLength segments off the far side of the tip segment, placed along its current
+    // chord. Their old positions are blended the same way, so they inherit the line's velocity there.
+    const int32 NumToInsert = RestLengths.Last() > 1.5f * TipSegmentLength ? FMath::FloorToInt((RestLengths.Last() - 0.5f * TipSegmentLength) / TipSegmentLength) : 0;
+    if (NumToInsert > 0)
+    {
+        const bool bHasPreviousStep = PreviousStepPositions.Num() == Particles.Num();
+        const float OldTipRestLength = RestLengths.Last();
+        const int32 FormerNeighbourIndex = GetTipIndex() - 1;
+        const int32 FirstNewIndex = GetTipIndex();
+
+        Particles.InsertPoints(FirstNewIndex, NumToInsert);
+        if (bHasPreviousStep)
+        {
+            PreviousStepPositions.InsertUninitialized(FirstNewIndex, NumToInsert);
+        }
+        RestLengths.InsertUninitialized(RestLengths.Num() - 1, NumToInsert);
+        RestLengths.Last() = OldTipRestLength - NumToInsert * TipSegmentLength;
+
+        const int32 TipIndex = GetTipIndex();
+        for (int32 i = FirstNewIndex; i < TipIndex; ++i)
+        {
+            const float Fraction = (i - FormerNeighbourIndex) * TipSegmentLength / OldTipRestLength;
+            // InsertPoints zeroed the new particles' acceleration and flags, so only position and mass are left to fill.
+            Particles.Positions[i] = FMath::Lerp(Particles.Positions[FormerNeighbourIndex], Particles.Positions[TipIndex], Fraction);
+            Particles.OldPositions[i] = FMath::Lerp(Particles.OldPositions[FormerNeighbourIndex], Particles.OldPositions[TipIndex], Fraction);
+            Particles.SetMass(i, DefaultParticleMass);
+            RestLengths[i - 1] = TipSegmentLength;
+            if (bHasPreviousStep)
+            {
+                PreviousStepPositions[i] = FMath::Lerp(PreviousStepPositions[FormerNeighbourIndex], PreviousStepPositions[TipIndex], Fraction);
+            }
+        }
+        for (int32 i = FormerNeighbourIndex; i < TipIndex; ++i)
+        {
+            RefreshParticleMass(i);
+        }
+
+        if (bUseAdaptiveResolution)
+        {
+            MergeSegmentsNearTip();
+        }
+    }
+
+    NumSegments = RestLengths.Num();
+    UE_LOG(LogFishingSystemLine, VeryVerbose, TEXT("UFishingLineComponent '%s': SpoolToTargetLength - Length %.1f, removed %d, inserted %d, %d segments."),
+        *GetName(), TargetCableLength, NumToRemove, NumToInsert, NumSegments);
+}
+
+void UFishingLineComponent::RemoveParticleRange(int32 Index, int32 Count)
+{
+    TArray<float>& RestLengths = Particles.RestLengths;
+    for (int32 i = 0; i < Count; ++i)
+    {
+        RestLengths[Index - 1] += RestLengths[Index + i];
+    }
+    RestLengths.RemoveAt(Index, Count, EAllowShrinking::No);
+
+    if (PreviousStepPositions.Num() == Particles.Num())
+    {
+        PreviousStepPositions.RemoveAt(Index, Count, EAllowShrinking::No);
+    }
+    Particles.RemovePoints(Index, Count);
+
+    RefreshParticleMass(Index - 1);
+    RefreshParticleMass(Index);
+}
+
+void UFishingLineComponent::MergeSegmentsNearTip()
+{
+    // Paid-out segments all start at DesiredSegmentLength. Merge neighbours back up to the adaptive layout as they move
+    // away from the tip. Only about AdaptiveBlendDistance of line is visited, so the cost does not grow with the cast,
+    // and the particles it removes are that close to the end of the arrays too.
+    const TArray<float>& RestLengths = Particles.RestLengths;
+    const double WindowEnd = double(AdaptiveBlendDistance) + MaxSegmentLength;
+    double Distance = RestLengths.Last();
+    int32 Segment = RestLengths.Num() - 2;
+    while (Segment >= 1 && Distance < WindowEnd)
+    {
+        const float MergedLength = RestLengths[Segment] + RestLengths[Segment - 1];
+        if (MergedLength <= GetAdaptiveSegmentLength(Distance + 0.5 * MergedLength))
+        {
+            // The merged segment takes Segment - 1's slot and is tried against the next one out.
+            RemoveParticleRange(Segment, 1);
+            --Segment;
+            continue;
+        }
+        Distance += RestLengths[Segment];
+        --Segment;
+    }
+}
+
+void UFishingLineComponent::SimulateCable(const FFishingLineStepInputs& Inputs, float DeltaTime, float AnchorAlpha)
 {
     if (Particles.Num() < 1 || DeltaTime <= 0.f) return;
 
-    const FVector Gravity = FVector(0, 0, GetWorld()->GetGravityZ() * CableGravityScale);
+    const FVector3f Gravity(Inputs.Gravity);
+
+    // An anchor keeps the previous step's position as its old one, and reaches this frame's location over the frame's
+    // steps rather than on the first of them. The solver then sees the rod tip's real velocity instead of a teleport.
+    auto MoveAnchor = [this](int32 Index, const FVector& Location, float Alpha)
+    {
+        Particles.OldPositions[Index] = Particles.Positions[Index];
+        Particles.Positions[Index] = FMath::Lerp(Particles.Positions[Index], Particles.ToLocal(Location), Alpha);
+    };
 
-    FVector CurrentStartPos = GetStartTransform().GetLocation();
-    Particles[0].Position = CurrentStartPos;
-    Particles[0].OldPosition = Particles[0].Position; 
+    const int32 TipIndex = GetTipIndex();
+    MoveAnchor(TipIndex, Inputs.StartLocation, AnchorAlpha);
 
-    USceneComponent* ResolvedEndComp = GetResolvedAttachEndComponent();
     bool bLastParticleIsTrulyFixedToExternal = false; 
+    const int32 LastIndex = 0;
 
-    if (Particles.Num() > 1 && ResolvedEndComp)
+    if (Particles.Num() > 1 && Inputs.bEndAttached)
     {
-        if (Particles.Last().bIsFixed) // Check the particle's own bIsFixed flag
+        if (Particles.IsFixed(LastIndex)) // Check the particle's own fixed flag
         {
             bLastParticleIsTrulyFixedToExternal = true;
-            FVector CurrentEndPos = GetAttachedEndPointTransform().GetLocation();
-            Particles.Last().Position = CurrentEndPos;
-            Particles.Last().OldPosition = Particles.Last().Position; 
-            UE_LOG(LogFishingSystemLine, VeryVerbose, TEXT("%s SimulateCable: Last particle IS fixed to external. Pos: %s"), *GetName(), *CurrentEndPos.ToString());
+            MoveAnchor(LastIndex, Inputs.EndLocation, Inputs.bEndLocationIsCurrent ? 1.0f : AnchorAlpha);
+            UE_LOG(LogFishingSystemLine, VeryVerbose, TEXT("%s SimulateCable: Last particle IS fixed to external. Pos: %s"), *GetName(), *Inputs.EndLocation.ToString());
         }
         else
         {
@@ -368,184 +1134,656 @@ void UFishingLineComponent::SimulateCable(float DeltaTime)
         }
     }
 
-    int32 StartSimIndex = 1; 
-    int32 EndSimIndex = Particles.Num();
+    int32 StartSimIndex = 0;
+    int32 EndSimIndex = TipIndex;
     if (bLastParticleIsTrulyFixedToExternal) 
     {
-        EndSimIndex = Particles.Num() - 1;
+        StartSimIndex = 1;
     }
 
-    for (int32 i = StartSimIndex; i < EndSimIndex; ++i)
+    if (Inputs.bVectorIntegrate)
     {
-        Particles[i].Integrate(DeltaTime, DampingFactor, Gravity);
+        FishingLineSolver::IntegrateVectorized(Particles, StartSimIndex, EndSimIndex, DeltaTime, DampingFactor, Gravity);
+    }
+    else
+    {
+        FishingLineSolver::Integrate(Particles, StartSimIndex, EndSimIndex, DeltaTime, DampingFactor, Gravity);
     }
 }
 
 
-void UFishingLineComponent::SolveConstraints(float DeltaTime)
+void UFishingLineComponent::SolveConstraints(const FFishingLineStepInputs& Inputs, float DeltaTime)
 {
     if (Particles.Num() < 2 || NumSegments == 0) return;
 
-    const float CurrentDesiredSegmentLength = TargetCableLength / FMath::Max(1, NumSegments);
-    // UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': SolveConstraints START. TargetLen=%.1f, NumSegs=%d, CurrentDesiredSegLen=%.2f. Iterations=%d, Stiffness=%.2f"),
-    //    *GetName(), TargetCableLength, NumSegments, CurrentDesiredSegmentLength, SolverIterations, StiffnessFactor);
+    // UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': SolveConstraints START. TargetLen=%.1f, NumSegs=%d. Iterations=%d, Stiffness=%.2f"),
+    //    *GetName(), TargetCableLength, NumSegments, SolverIterations, StiffnessFactor);
 
-    for (int32 Iter = 0; Iter < SolverIterations; ++Iter)
+    // Tethers first so the distance solve starts from a line with no accumulated stretch, and again after it so
+    // whatever the solver leaves over cannot put a particle farther from the rod tip than the line allows.
+    if (bUseLongRangeAttachments)
     {
-        for (int32 i = 0; i < NumSegments; ++i)
+        FishingLineSolver::ApplyLongRangeAttachments(Particles, GetTipIndex());
+    }
+
+    // With contacts, the sweeps are split into passes with a contact projection after each, so the line settles
+    // around obstacles instead of contacts just overriding the final sweep.
+    const int32 NumPasses = Inputs.bWorldCollision ? CollisionSolvePasses : 1;
+    const int32 TotalIterations = (SolverType == EFishingLineSolverType::DirectTridiagonal) ? DirectSolverPasses : SolverIterations;
+    const bool bAdaptive = bUseAdaptiveIterations && SolverTolerance > 0.0f;
+    int32 SweepsRun = 0;
+    for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+    {
+        const int32 PassIterations = FMath::Max(1, TotalIterations * (Pass + 1) / NumPasses - TotalIterations * Pass / NumPasses);
+
+        if (bAdaptive)
         {
-            FVerletPoint& P1 = Particles[i];
-            FVerletPoint& P2 = Particles[i+1];
+            // A few sweeps at a time, checking the error the last one corrected; the pass's share of the budget is only the cap.
+            for (int32 PassSweeps = 0; PassSweeps < PassIterations;)
+            {
+                const int32 Sweeps = FMath::Min(AdaptiveCheckInterval, PassIterations - PassSweeps);
+                const float SweepResidual = SolveDistanceConstraints(Inputs, DeltaTime, Sweeps, Pass == 0 && PassSweeps == 0);
+                PassSweeps += Sweeps;
+                SweepsRun += Sweeps;
+                if (SweepResidual <= SolverTolerance)
+                {
+                    break;
+                }
+            }
+        }
+        else
+        {
+            SolveDistanceConstraints(Inputs, DeltaTime, PassIterations, Pass == 0);
+            SweepsRun += PassIterations;
+        }
 
-            FVector Delta = P2.Position - P1.Position;
-            float CurrentLength = Delta.Size();
+        if (bUseLongRangeAttachments && Pass == NumPasses - 1)
+        {
+            FishingLineSolver::ApplyLongRangeAttachments(Particles, GetTipIndex());
+        }
 
-            if (CurrentLength < KINDA_SMALL_NUMBER) continue;
+        if (Inputs.bWorldCollision)
+        {
+            SCOPE_CYCLE_COUNTER(STAT_FishingLineCollisionNarrowphase);
+            FishingLineSolver::SolveCollisions(Particles, CollisionShapes, Inputs.ParticleCollisionRadius);
+        }
+    }
+
+    // Measured after tethers and contacts, since either can undo part of the solve.
+    FrameSolverIterations += SweepsRun;
+    FrameSolverResidual = FishingLineSolver::ComputeMaxRelativeError(Particles);
+    INC_DWORD_STAT(STAT_FishingLineSolverSteps);
+    INC_DWORD_STAT_BY(STAT_FishingLineSolverSweeps, SweepsRun);
+    if (SweepsRun < FMath::Max(TotalIterations, NumPasses))
+    {
+        INC_DWORD_STAT(STAT_FishingLineSolverEarlyOuts);
+    }
+    // UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': SolveConstraints END."), *GetName());
+}
 
-            float Error = CurrentLength - CurrentDesiredSegmentLength;
-            FVector CorrectionDirection = Delta / CurrentLength;
-            FVector Correction = CorrectionDirection * Error * StiffnessFactor;
+float UFishingLineComponent::SolveDistanceConstraints(const FFishingLineStepInputs& Inputs, float DeltaTime, int32 Iterations, bool bFirstInStep)
+{
+    switch (SolverType)
+    {
+    case EFishingLineSolverType::DirectTridiagonal:
+        FishingLineSolver::SolveDistanceConstraintsDirect(Particles, SolverScratch, Iterations);
+        return FishingLineSolver::ComputeMaxRelativeError(Particles);
 
-            bool bP1IsCableStartFixedPoint = P1.bIsFixed; // Particle 0's bIsFixed should be true
-            bool bP2IsCableEndFixedPoint = P2.bIsFixed;   // Last particle's bIsFixed should be true if attached
+    case EFishingLineSolverType::XPBD:
+        FishingLineSolver::SolveDistanceConstraintsXPBD(Particles, SolverScratch, Iterations, LineCompliance, DeltaTime, bFirstInStep);
+        return FishingLineSolver::ComputeMaxRelativeError(Particles);
 
-            // UE_LOG(LogFishingSystemLine, VeryVerbose, TEXT("UFishingLineComponent '%s': SolveConstraints Iter %d, Seg %d (P%d-P%d): Err=%.2f. P1(idx%d)_Fixed=%s, P2(idx%d)_Fixed=%s. CorrectionVec: %s"),
-            //    *GetName(), Iter, i, i, i+1, Error,
-            //    i, bP1IsCableStartFixedPoint ? TEXT("T") : TEXT("F"),
-            //    i+1, bP2IsCableEndFixedPoint ? TEXT("T") : TEXT("F"),
-            //    *Correction.ToString());
-            
-            float P1_MoveRatio, P2_MoveRatio;
-            if (bP1IsCableStartFixedPoint && bP2IsCableEndFixedPoint) { P1_MoveRatio = 0.0f; P2_MoveRatio = 0.0f; }
-            else if (bP1IsCableStartFixedPoint) { P1_MoveRatio = 0.0f; P2_MoveRatio = 1.0f; }
-            else if (bP2IsCableEndFixedPoint) { P1_MoveRatio = 1.0f; P2_MoveRatio = 0.0f; }
-            else { P1_MoveRatio = 0.5f; P2_MoveRatio = 0.5f; }
+    case EFishingLineSolverType::Multigrid:
+        if (bFirstInStep)
+        {
+            FishingLineSolver::SolveCoarseLevels(Particles, SolverScratch, MultigridLevels, MultigridCoarseningFactor, MultigridCoarseIterations);
+        }
+        // The fine sweeps are the Gauss-Seidel ones.
+        [[fallthrough]];
 
-            if (P1_MoveRatio > 0.0f)
-            {
-                P1.Position += Correction * P1_MoveRatio;
-            }
-            if (P2_MoveRatio > 0.0f)
-            {
-                P2.Position -= Correction * P2_MoveRatio;
-            }
+    case EFishingLineSolverType::GaussSeidel:
+    default:
+        if (Inputs.bParallelSolve && ParallelSolveParticleThreshold > 0 && Particles.Num() >= ParallelSolveParticleThreshold)
+        {
+            return FishingLineSolver::SolveDistanceConstraintsParallel(Particles, Iterations, StiffnessFactor, ParallelSolveSegmentsPerTask);
+        }
+        if (Inputs.bISPCConstraints)
+        {
+            return FishingLineSolver::SolveDistanceConstraintsISPC(Particles, Iterations, StiffnessFactor);
         }
+        return FishingLineSolver::SolveDistanceConstraints(Particles, Iterations, StiffnessFactor);
     }
-    // UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': SolveConstraints END."), *GetName());
 }
 
-void UFishingLineComponent::UpdateCableMesh()
+void UFishingLineComponent::StepFixedTimestep(const FFishingLineStepInputs& Inputs)
 {
-    if (!ProceduralMesh || Particles.Num() < 2 || CableWidth <= 0.f)
+    const float DeltaTime = Inputs.DeltaTime;
+    const float StepTime = 1.0f / FMath::Max(FixedSimulationRate, 1.0f);
+    const int32 MaxSteps = FMath::Max(1, MaxSubstepsPerFrame);
+
+    TimeAccumulator += FMath::Max(DeltaTime, 0.0f);
+    int32 NumSteps = FMath::FloorToInt(TimeAccumulator / StepTime);
+    if (NumSteps > MaxSteps)
     {
-        if (ProceduralMesh && ProceduralMesh->GetNumSections() > 0) ProceduralMesh->ClearMeshSection(0);
-        return;
+        UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': StepFixedTimestep - %d steps owed, capped to %d. Dropping %.3fs of simulation time."),
+            *GetName(), NumSteps, MaxSteps, TimeAccumulator - MaxSteps * StepTime);
+        NumSteps = MaxSteps;
+        TimeAccumulator = MaxSteps * StepTime;
     }
-    const FTransform WorldToLocal = GetComponentTransform().Inverse();
-    TArray<FVector> LocalVertices;
-    TArray<int32> Triangles;
-    TArray<FVector> LocalNormals;
-    TArray<FVector2D> UVs;
-    TArray<FProcMeshTangent> LocalTangents; // Not used yet, but good to have
 
-    if (Particles.Num() < 2) return; // Need at least 2 particles for a segment
+    // TimeAccumulator now spans from the last step to this frame. Each step moves the anchors by its share of what is left
+    // of that span; time the steps do not cover stays owed, as does the rest of the anchors' way.
+    const float AnchorTravelTime = TimeAccumulator;
+    for (int32 Step = 0; Step < NumSteps; ++Step)
+    {
+        const float RemainingTravelTime = AnchorTravelTime - Step * StepTime;
+        const float AnchorAlpha = RemainingTravelTime > StepTime ? StepTime / RemainingTravelTime : 1.0f;
 
-    FVector PrevParticlePos_World = Particles[0].Position;
-    // Initial segment direction from first two particles
-    FVector SegmentDirection_World = (Particles.Num() > 1) ? (Particles[1].Position - Particles[0].Position).GetSafeNormal() : GetForwardVector(); // Fallback
-    if (SegmentDirection_World.IsNearlyZero()) SegmentDirection_World = GetForwardVector(); // Further fallback
+        PreviousStepPositions = Particles.Positions;
+        SimulateCable(Inputs, StepTime, AnchorAlpha);
+        SolveConstraints(Inputs, StepTime);
+        TimeAccumulator -= StepTime;
+    }
 
-    FVector PrevRight_World = FVector::CrossProduct(SegmentDirection_World, GetUpVector()).GetSafeNormal();
-    if (PrevRight_World.IsNearlyZero()) PrevRight_World = FVector::CrossProduct(SegmentDirection_World, FVector::UpVector).GetSafeNormal();
-    if (PrevRight_World.IsNearlyZero()) PrevRight_World = GetRightVector();
+    UpdateInterpolatedPositions(Inputs, FMath::Clamp(TimeAccumulator / StepTime, 0.0f, 1.0f));
+}
 
+void UFishingLineComponent::UpdateInterpolatedPositions(const FFishingLineStepInputs& Inputs, float Alpha)
+{
+    const int32 NumPoints = Particles.Num();
+    if (PreviousStepPositions.Num() != NumPoints)
+    {
+        PreviousStepPositions = Particles.Positions;
+    }
 
-    float CurrentV = 0.0f;
-    const float UVXScale = 1.0f; // Controls V coordinate tiling
+    // Blended in solver space, then taken back to world space; this is the only place simulated positions leave it. They
+    // leave it tip first, the order everything outside the solver expects.
+    InterpolatedPositions.SetNumUninitialized(NumPoints);
+    for (int32 i = 0; i < NumPoints; ++i)
+    {
+        const int32 Index = NumPoints - 1 - i;
+        const FVector3f& Position = Particles.Positions[Index];
+        InterpolatedPositions[i] = Particles.ToWorld(Alpha < 1.0f ? FMath::Lerp(PreviousStepPositions[Index], Position, Alpha) : Position);
+    }
+
+    // Anchored ends follow their attachment this frame rather than lagging up to one step behind it.
+    if (NumPoints > 0)
+    {
+        InterpolatedPositions[0] = Inputs.StartLocation;
+    }
+    if (NumPoints > 1 && Particles.IsFixed(0) && Inputs.bEndAttached)
+    {
+        InterpolatedPositions[NumPoints - 1] = Inputs.EndLocation;
+    }
+}
+
+void UFishingLineComponent::RebaseSolverSpace(const FVector& NewOrigin)
+{
+    const FVector3f Offset(Particles.SpaceOrigin - NewOrigin);
+    if (PreviousStepPositions.Num() == Particles.Num())
+    {
+        for (FVector3f& Position : PreviousStepPositions)
+        {
+            Position += Offset;
+        }
+    }
+    Particles.Rebase(NewOrigin);
+}
+
+const TArray<FVector>& UFishingLineComponent::GetSimulatedRenderPositions() const
+{
+    return InterpolatedPositions;
+}
+
+const TArray<FVector>& UFishingLineComponent::GetRenderPositions() const
+{
+    // The published result is never written by a running task, so game-thread readers always see a whole frame.
+    // RebuildParticles seeds it, so it is never behind the particles; InterpolatedPositions may be mid-write.
+    return FrameResults[PublishedFrameResult].Positions;
+}
+
+bool UFishingLineComponent::CanSleep() const
+{
+    return bAllowSleep && CVarFishingLineAllowSleep.GetValueOnGameThread() != 0;
+}
+
+FVector UFishingLineComponent::GetSleepEndLocation() const
+{
+    // A free end is simulated, not driven, so only an attached end counts as an anchor.
+    return GetResolvedAttachEndComponent() ? GetAttachedEndPointTransform().GetLocation() : FVector::ZeroVector;
+}
+
+bool UFishingLineComponent::HaveAnchorsMovedSinceSleep() const
+{
+    const float WakeDistanceSquared = FMath::Square(SleepWakeDistance);
+    return FVector::DistSquared(GetStartTransform().GetLocation(), LastStartLocation) > WakeDistanceSquared
+        || FVector::DistSquared(GetSleepEndLocation(), LastEndLocation) > WakeDistanceSquared;
+}
 
+void UFishingLineComponent::UpdateSleepState(float DeltaTime)
+{
+    const FVector StartLocation = GetStartTransform().GetLocation();
+    const FVector EndLocation = GetSleepEndLocation();
+    const double AnchorDisplacementSquared = FMath::Max(FVector::DistSquared(StartLocation, LastStartLocation), FVector::DistSquared(EndLocation, LastEndLocation));
+    LastStartLocation = StartLocation;
+    LastEndLocation = EndLocation;
+
+    if (!CanSleep() || DeltaTime <= 0.f)
+    {
+        SleepCandidateFrames = 0;
+        return;
+    }
+
+    // Kinetic energy per unit mass of the free particles, as a mass-weighted mean squared speed over the last step.
+    const float StepTime = bUseFixedTimestep ? 1.0f / FMath::Max(FixedSimulationRate, 1.0f) : DeltaTime;
+    double WeightedDisplacementSquared = 0.0;
+    double TotalMass = 0.0;
     for (int32 i = 0; i < Particles.Num(); ++i)
     {
-        const FVector& ParticlePos_World = Particles[i].Position;
-        FVector CurrentSegmentDirection_World;
+        if (Particles.IsFixed(i)) continue;
+        const double Mass = Particles.GetMass(i);
+        WeightedDisplacementSquared += Mass * FVector3f::DistSquared(Particles.Positions[i], Particles.OldPositions[i]);
+        TotalMass += Mass;
+    }
+    const double MeanSquaredSpeed = TotalMass > 0.0 ? WeightedDisplacementSquared / (TotalMass * StepTime * StepTime) : 0.0;
+    const double AnchorSpeedSquared = AnchorDisplacementSquared / (DeltaTime * DeltaTime);
+    const double ThresholdSquared = FMath::Square(double(SleepSpeedThreshold));
+
+    if (MeanSquaredSpeed < ThresholdSquared && AnchorSpeedSquared < ThresholdSquared)
+    {
+        if (++SleepCandidateFrames >= SleepFrameCount)
+        {
+            bIsSleeping = true;
+            UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineComponent '%s': Falling asleep after %d quiet frames."), *GetName(), SleepCandidateFrames);
+        }
+    }
+    else
+    {
+        SleepCandidateFrames = 0;
+    }
+}
+
+void UFishingLineComponent::BuildCableMesh(const TArray<FVector>& Positions, const FFishingLineStepInputs& Inputs, FFishingLineMeshData& OutMesh) const
+{
+    // Runs on whichever thread steps the simulation: component state comes from Inputs, not from the scene.
+    // Every array is resized in place, so once OutMesh has seen the line's size a frame allocates nothing.
+    OutMesh.Bounds = FBox(ForceInit);
+
+    if (Positions.Num() < 2 || CableWidth <= 0.f || MeshTessellation < 1) // Need at least 2 particles for a segment
+    {
+        OutMesh.Vertices.Reset();
+        OutMesh.Normals.Reset();
+        OutMesh.Tangents.Reset();
+        OutMesh.UVs.Reset();
+        OutMesh.Triangles.Reset();
+        OutMesh.TopologyRings = 0;
+        OutMesh.TopologySides = 0;
+        return;
+    }
+
+    // Rings go around the spline points when upsampling, around the particles themselves otherwise.
+    const TArray<FVector>* RingCenters = &Positions;
+    if (RenderRingsPerSegment > 1)
+    {
+        UpsampleRenderPoints(Positions, Inputs.PreviousRenderRings, OutMesh.RenderPoints);
+        RingCenters = &OutMesh.RenderPoints;
+    }
+
+    bool bRibbon = RenderMode == EFishingLineRenderMode::Ribbon;
+    if (RenderMode == EFishingLineRenderMode::Automatic && Inputs.bHasViewLocation)
+    {
+        bRibbon = true;
+        const double RibbonDistSq = FMath::Square((double)RibbonDistance);
+        for (const FVector& Position : Positions)
+        {
+            if (FVector::DistSquared(Position, Inputs.ViewLocation) < RibbonDistSq)
+            {
+                bRibbon = false;
+                break;
+            }
+        }
+    }
+
+    if (bRibbon && Inputs.bHasViewLocation)
+    {
+        BuildRibbonMesh(*RingCenters, Inputs, OutMesh);
+    }
+    else
+    {
+        BuildTubeMesh(*RingCenters, Inputs, OutMesh);
+    }
 
-        if (i < Particles.Num() - 1) CurrentSegmentDirection_World = (Particles[i+1].Position - ParticlePos_World).GetSafeNormal();
-        else if (Particles.Num() > 1) CurrentSegmentDirection_World = (ParticlePos_World - Particles[i-1].Position).GetSafeNormal();
-        else CurrentSegmentDirection_World = SegmentDirection_World; // Use initial if only one particle somehow
-        
-        if (CurrentSegmentDirection_World.IsNearlyZero()) CurrentSegmentDirection_World = SegmentDirection_World; // Fallback
+    for (const FVector& P_Local : OutMesh.Vertices) OutMesh.Bounds += P_Local;
+}
 
+void UFishingLineComponent::UpsampleRenderPoints(const TArray<FVector>& Positions, int32 PreviousNumPoints, TArray<FVector>& OutPoints) const
+{
+    const int32 NumPoints = Positions.Num();
 
-        // Calculate a consistent right vector along the cable
-        FVector RightVector_World = FVector::CrossProduct(CurrentSegmentDirection_World, PrevRight_World).GetSafeNormal(); // This gives a vector mostly perpendicular to both
-        RightVector_World = FVector::CrossProduct(RightVector_World, CurrentSegmentDirection_World).GetSafeNormal(); // This makes it truly perpendicular to CurrentSegmentDirection
-        
-        if(RightVector_World.IsNearlyZero() || !RightVector_World.IsNormalized()) RightVector_World = PrevRight_World; // Fallback if directions align
-        else PrevRight_World = RightVector_World; // Update for next segment
+    // Catmull-Rom style tangents, per unit of chord length so that uneven segments (short ones near the tip) do not
+    // overshoot. At the ends they fall back to the end segment's direction.
+    auto ArcTangent = [&Positions, NumPoints](int32 i)
+    {
+        const int32 Prev = FMath::Max(i - 1, 0);
+        const int32 Next = FMath::Min(i + 1, NumPoints - 1);
+        const double Span = FVector::Dist(Positions[Prev], Positions[i]) + FVector::Dist(Positions[i], Positions[Next]);
+        return Span > UE_SMALL_NUMBER ? (Positions[Next] - Positions[Prev]) / Span : FVector::ZeroVector;
+    };
+
+    const float MaxBendPerRing = FMath::DegreesToRadians(FMath::Max(RenderRingAngle, 0.1f));
+    OutPoints.Reset();
+    FVector TangentA = ArcTangent(0);
+    for (int32 Seg = 0; Seg < NumPoints - 1; ++Seg)
+    {
+        const FVector& A = Positions[Seg];
+        const FVector& B = Positions[Seg + 1];
+        const FVector TangentB = ArcTangent(Seg + 1);
 
-        for (int32 Side = 0; Side < MeshTessellation; ++Side)
+        int32 NumRings = RenderRingsPerSegment;
+        if (bAdaptiveRenderRings)
         {
-            float Angle = ((float)Side / MeshTessellation) * 2.0f * PI;
-            FVector Offset_World = RightVector_World.RotateAngleAxisRad(Angle, CurrentSegmentDirection_World) * (CableWidth * 0.5f);
-            FVector VertexPos_World = ParticlePos_World + Offset_World;
+            const double CosBend = FVector::DotProduct(TangentA.GetSafeNormal(), TangentB.GetSafeNormal());
+            const float Bend = FMath::Acos(FMath::Clamp(CosBend, -1.0, 1.0));
+            NumRings = FMath::Clamp(FMath::CeilToInt(Bend / MaxBendPerRing), 1, RenderRingsPerSegment);
+        }
 
-            LocalVertices.Add(WorldToLocal.TransformPosition(VertexPos_World));
-            LocalNormals.Add(WorldToLocal.TransformVectorNoScale(Offset_World.GetSafeNormal())); // Normals shouldn't be scaled
-            UVs.Add(FVector2D( (float)Side / MeshTessellation, CurrentV));
+        // The Hermite segment as a Bezier: control points a third of the chord along each end's tangent.
+        OutPoints.Add(A);
+        const double Length = FVector::Dist(A, B);
+        const FVector ControlA = A + TangentA * (Length / 3.0);
+        const FVector ControlB = B - TangentB * (Length / 3.0);
+        for (int32 Ring = 1; Ring < NumRings; ++Ring)
+        {
+            OutPoints.Add(EvaluateCubicBezier(A, ControlA, ControlB, B, (float)Ring / NumRings));
         }
-        CurrentV += (i > 0) ? UVXScale * FVector::Dist(ParticlePos_World, PrevParticlePos_World) / FMath::Max(DesiredSegmentLength, 1.0f) : 0.0f;
-        PrevParticlePos_World = ParticlePos_World;
-        SegmentDirection_World = CurrentSegmentDirection_World; // Update for next iteration's PrevRight calculation
+        TangentA = TangentB;
     }
+    OutPoints.Add(Positions.Last());
 
-    for (int32 SegIdx = 0; SegIdx < Particles.Num() - 1; ++SegIdx)
+    if (bAdaptiveRenderRings)
     {
-        for (int32 SideIdx = 0; SideIdx < MeshTessellation; ++SideIdx)
+        // Pad to a fixed size with rings collapsed onto the end point: zero-area triangles cost nothing to draw, whereas
+        // a new vertex count rebuilds the index buffer or the procedural section. Shrink only when two sizes free up,
+        // so a line bending back and forth across a size does not switch every frame.
+        const int32 NeededPoints = OutPoints.Num();
+        const int32 MaxPoints = (NumPoints - 1) * RenderRingsPerSegment + 1;
+        const int32 SizeStep = FMath::Max(1, FMath::DivideAndRoundUp(MaxPoints - NumPoints, AdaptiveRenderRingSizes));
+        int32 PaddedPoints = FMath::Min(NumPoints + FMath::DivideAndRoundUp(NeededPoints - NumPoints, SizeStep) * SizeStep, MaxPoints);
+        if (PreviousNumPoints >= NeededPoints && PreviousNumPoints <= MaxPoints && PreviousNumPoints - NeededPoints < 2 * SizeStep)
         {
-            int32 TL = SegIdx * MeshTessellation + SideIdx;
-            int32 TR = SegIdx * MeshTessellation + (SideIdx + 1) % MeshTessellation;
-            int32 BL = (SegIdx + 1) * MeshTessellation + SideIdx;
-            int32 BR = (SegIdx + 1) * MeshTessellation + (SideIdx + 1) % MeshTessellation;
-            Triangles.Add(TL); Triangles.Add(BL); Triangles.Add(TR);
-            Triangles.Add(TR); Triangles.Add(BL); Triangles.Add(BR);
+            PaddedPoints = PreviousNumPoints;
+        }
+        while (OutPoints.Num() < PaddedPoints)
+        {
+            OutPoints.Add(Positions.Last());
         }
     }
-    
-    if (bSmoothNormals && LocalNormals.Num() == LocalVertices.Num() && Triangles.Num() > 0)
+}
+
+void UFishingLineComponent::BuildTubeMesh(const TArray<FVector>& Positions, const FFishingLineStepInputs& Inputs, FFishingLineMeshData& OutMesh) const
+{
+    const int32 NumRings = Positions.Num();
+    const int32 NumSides = MeshTessellation;
+    const int32 NumVertices = NumRings * NumSides;
+    OutMesh.Vertices.SetNumUninitialized(NumVertices);
+    OutMesh.Normals.SetNumUninitialized(NumVertices);
+    OutMesh.Tangents.SetNumUninitialized(NumVertices);
+    OutMesh.UVs.SetNumUninitialized(NumVertices);
+
+    // Ring angles once per mesh instead of a sin/cos per vertex.
+    TArray<float, TInlineAllocator<32>> RingCos;
+    TArray<float, TInlineAllocator<32>> RingSin;
+    RingCos.SetNumUninitialized(NumSides);
+    RingSin.SetNumUninitialized(NumSides);
+    for (int32 Side = 0; Side < NumSides; ++Side)
+    {
+        FMath::SinCos(&RingSin[Side], &RingCos[Side], 2.0f * PI * Side / NumSides);
+    }
+
+    // Each ring's frame, one stream per component and padded to whole four-ring batches, so the vertices can be built
+    // for four rings at a time whatever MeshTessellation is.
+    const int32 NumPaddedRings = Align(NumRings, 4);
+    OutMesh.RingFrames.SetNumUninitialized(FFishingLineMeshData::NumRingStreams * NumPaddedRings);
+    auto RingStream = [&OutMesh, NumPaddedRings](int32 Stream) { return OutMesh.RingFrames.GetData() + Stream * NumPaddedRings; };
+    for (int32 Stream = 0; Stream < FFishingLineMeshData::NumRingStreams; ++Stream)
+    {
+        FMemory::Memzero(RingStream(Stream) + NumRings, (NumPaddedRings - NumRings) * sizeof(float));
+    }
+    auto StoreRingVector = [&RingStream](int32 FirstStream, int32 Ring, const FVector3f& Value)
+    {
+        RingStream(FirstStream)[Ring] = Value.X;
+        RingStream(FirstStream + 1)[Ring] = Value.Y;
+        RingStream(FirstStream + 2)[Ring] = Value.Z;
+    };
+
+    const FTransform WorldToLocal = Inputs.ComponentToWorld.Inverse();
+    const float Radius = CableWidth * 0.5f;
+
+    auto SegmentDirection = [&Positions, NumRings](int32 i, const FVector& Fallback)
+    {
+        const FVector Direction = (i < NumRings - 1 ? Positions[i + 1] - Positions[i] : Positions[i] - Positions[i - 1]).GetSafeNormal();
+        return Direction.IsNearlyZero() ? Fallback : Direction;
+    };
+
+    // First frame: the component's right axis, or failing that its up axis, made perpendicular to the first segment.
+    FVector Tangent = SegmentDirection(0, Inputs.ComponentToWorld.GetUnitAxis(EAxis::X));
+    FVector Normal = FVector::VectorPlaneProject(Inputs.ComponentToWorld.GetUnitAxis(EAxis::Y), Tangent).GetSafeNormal();
+    if (Normal.IsNearlyZero()) Normal = FVector::VectorPlaneProject(Inputs.ComponentToWorld.GetUnitAxis(EAxis::Z), Tangent).GetSafeNormal();
+
+    float CurrentV = 0.0f;
+    for (int32 i = 0; i < NumRings; ++i)
+    {
+        if (i > 0)
+        {
+            // Rotation-minimizing frame by double reflection (Wang et al. 2008): the previous frame is reflected across the
+            // bisector plane of the segment, then across the one that maps the reflected tangent onto the new tangent.
+            // The rings therefore do not twist around the line as it bends.
+            const FVector NextTangent = SegmentDirection(i, Tangent);
+            const FVector Segment = Positions[i] - Positions[i - 1];
+            const double SegmentSq = Segment.SizeSquared();
+            FVector ReflectedNormal = Normal;
+            FVector ReflectedTangent = Tangent;
+            if (SegmentSq > UE_SMALL_NUMBER)
+            {
+                ReflectedNormal -= (2.0 / SegmentSq) * (Segment | Normal) * Segment;
+                ReflectedTangent -= (2.0 / SegmentSq) * (Segment | Tangent) * Segment;
+            }
+            const FVector Mirror = NextTangent - ReflectedTangent;
+            const double MirrorSq = Mirror.SizeSquared();
+            if (MirrorSq > UE_SMALL_NUMBER)
+            {
+                ReflectedNormal -= (2.0 / MirrorSq) * (Mirror | ReflectedNormal) * Mirror;
+            }
+            // Re-orthonormalized, so rounding does not accumulate along a long line.
+            const FVector NextNormal = FVector::VectorPlaneProject(ReflectedNormal, NextTangent).GetSafeNormal();
+            if (!NextNormal.IsNearlyZero()) Normal = NextNormal;
+            Tangent = NextTangent;
+
+            CurrentV += FVector::Dist(Positions[i], Positions[i - 1]) / FMath::Max(DesiredSegmentLength, 1.0f);
+        }
+        const FVector Binormal = FVector::CrossProduct(Tangent, Normal);
+
+        // A ring vertex is Center + Radius * (Normal * cos + Binormal * sin), and its normal is that same direction.
+        // Offsets carry the component's scale, normals do not.
+        StoreRingVector(FFishingLineMeshData::RingCenterX, i, FVector3f(WorldToLocal.TransformPosition(Positions[i])));
+        StoreRingVector(FFishingLineMeshData::RingOffsetNX, i, FVector3f(WorldToLocal.TransformVector(Normal * Radius)));
+        StoreRingVector(FFishingLineMeshData::RingOffsetBX, i, FVector3f(WorldToLocal.TransformVector(Binormal * Radius)));
+        StoreRingVector(FFishingLineMeshData::RingNormalNX, i, FVector3f(WorldToLocal.TransformVectorNoScale(Normal)));
+        StoreRingVector(FFishingLineMeshData::RingNormalBX, i, FVector3f(WorldToLocal.TransformVectorNoScale(Binormal)));
+        StoreRingVector(FFishingLineMeshData::RingTangentX, i, FVector3f(WorldToLocal.TransformVectorNoScale(Tangent)));
+        RingStream(FFishingLineMeshData::RingV)[i] = CurrentV;
+    }
+
+    // Four rings per batch: each side's vertices for the batch are two multiply-adds per axis.
+    for (int32 Ring = 0; Ring < NumRings; Ring += 4)
     {
-        TArray<FVector> SmoothedLocalNormals;
-        SmoothedLocalNormals.AddZeroed(LocalVertices.Num());
-        for(int32 TriIdx = 0; TriIdx < Triangles.Num(); TriIdx += 3)
+        VectorRegister4Float Center[3], OffsetN[3], OffsetB[3], NormalN[3], NormalB[3];
+        for (int32 Axis = 0; Axis < 3; ++Axis)
         {
-            int32 V0Idx = Triangles[TriIdx + 0];
-            int32 V1Idx = Triangles[TriIdx + 1];
-            int32 V2Idx = Triangles[TriIdx + 2];
-            FVector FaceNormal_Local = FVector::CrossProduct(LocalVertices[V1Idx] - LocalVertices[V0Idx], LocalVertices[V2Idx] - LocalVertices[V0Idx]).GetSafeNormal();
-            SmoothedLocalNormals[V0Idx] += FaceNormal_Local;
-            SmoothedLocalNormals[V1Idx] += FaceNormal_Local;
-            SmoothedLocalNormals[V2Idx] += FaceNormal_Local;
+            Center[Axis] = VectorLoadAligned(RingStream(FFishingLineMeshData::RingCenterX + Axis) + Ring);
+            OffsetN[Axis] = VectorLoadAligned(RingStream(FFishingLineMeshData::RingOffsetNX + Axis) + Ring);
+            OffsetB[Axis] = VectorLoadAligned(RingStream(FFishingLineMeshData::RingOffsetBX + Axis) + Ring);
+            NormalN[Axis] = VectorLoadAligned(RingStream(FFishingLineMeshData::RingNormalNX + Axis) + Ring);
+            NormalB[Axis] = VectorLoadAligned(RingStream(FFishingLineMeshData::RingNormalBX + Axis) + Ring);
+        }
+        const int32 BatchRings = FMath::Min(4, NumRings - Ring);
+
+        for (int32 Side = 0; Side < NumSides; ++Side)
+        {
+            const VectorRegister4Float Cos = VectorSetFloat1(RingCos[Side]);
+            const VectorRegister4Float Sin = VectorSetFloat1(RingSin[Side]);
+            alignas(16) float Vertices[3][4];
+            alignas(16) float Normals[3][4];
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                VectorStoreAligned(VectorMultiplyAdd(OffsetN[Axis], Cos, VectorMultiplyAdd(OffsetB[Axis], Sin, Center[Axis])), Vertices[Axis]);
+                VectorStoreAligned(VectorMultiplyAdd(NormalN[Axis], Cos, VectorMultiply(NormalB[Axis], Sin)), Normals[Axis]);
+            }
+
+            const float U = (float)Side / NumSides;
+            for (int32 Lane = 0; Lane < BatchRings; ++Lane)
+            {
+                const int32 RingIndex = Ring + Lane;
+                const int32 VertexIndex = RingIndex * NumSides + Side;
+                OutMesh.Vertices[VertexIndex] = FVector(Vertices[0][Lane], Vertices[1][Lane], Vertices[2][Lane]);
+                OutMesh.Normals[VertexIndex] = FVector(Normals[0][Lane], Normals[1][Lane], Normals[2][Lane]);
+                OutMesh.Tangents[VertexIndex] = FVector(RingStream(FFishingLineMeshData::RingTangentX)[RingIndex],
+                    RingStream(FFishingLineMeshData::RingTangentX + 1)[RingIndex], RingStream(FFishingLineMeshData::RingTangentX + 2)[RingIndex]);
+                OutMesh.UVs[VertexIndex] = FVector2D(U, RingStream(FFishingLineMeshData::RingV)[RingIndex]);
+            }
         }
-        for(int32 i=0; i<SmoothedLocalNormals.Num(); ++i) LocalNormals[i] = SmoothedLocalNormals[i].GetSafeNormal();
     }
 
-    if (LocalVertices.Num() > 0 && Triangles.Num() > 0)
+    // Indices only depend on the ring count and size; they are kept until either changes.
+    TArray<int32>& Triangles = OutMesh.Triangles;
+    if (OutMesh.TopologyRings != NumRings || OutMesh.TopologySides != NumSides || OutMesh.bRibbonTopology)
     {
-        ProceduralMesh->CreateMeshSection(0, LocalVertices, Triangles, LocalNormals, UVs, TArray<FColor>(), LocalTangents, false);
-        if (CableMaterial) ProceduralMesh->SetMaterial(0, CableMaterial);
+        Triangles.SetNumUninitialized((NumRings - 1) * NumSides * 6);
+        int32* Index = Triangles.GetData();
+        for (int32 SegIdx = 0; SegIdx < NumRings - 1; ++SegIdx)
+        {
+            for (int32 SideIdx = 0; SideIdx < NumSides; ++SideIdx)
+            {
+                int32 TL = SegIdx * NumSides + SideIdx;
+                int32 TR = SegIdx * NumSides + (SideIdx + 1) % NumSides;
+                int32 BL = (SegIdx + 1) * NumSides + SideIdx;
+                int32 BR = (SegIdx + 1) * NumSides + (SideIdx + 1) % NumSides;
+                *Index++ = TL; *Index++ = BL; *Index++ = TR;
+                *Index++ = TR; *Index++ = BL; *Index++ = BR;
+            }
+        }
+        OutMesh.TopologyRings = NumRings;
+        OutMesh.TopologySides = NumSides;
+        OutMesh.bRibbonTopology = false;
     }
-    else
+}
+
+void UFishingLineComponent::BuildRibbonMesh(const TArray<FVector>& Positions, const FFishingLineStepInputs& Inputs, FFishingLineMeshData& OutMesh) const
+{
+    const int32 NumRings = Positions.Num();
+    const int32 NumVertices = NumRings * 2;
+    OutMesh.Vertices.SetNumUninitialized(NumVertices);
+    OutMesh.Normals.SetNumUninitialized(NumVertices);
+    OutMesh.Tangents.SetNumUninitialized(NumVertices);
+    OutMesh.UVs.SetNumUninitialized(NumVertices);
+
+    const FTransform WorldToLocal = Inputs.ComponentToWorld.Inverse();
+    const float HalfWidth = CableWidth * 0.5f;
+    FVector PrevSide_World = Inputs.ComponentToWorld.GetUnitAxis(EAxis::Y);
+    FVector PrevDirection_World = Inputs.ComponentToWorld.GetUnitAxis(EAxis::X);
+    float CurrentV = 0.0f;
+
+    for (int32 i = 0; i < NumRings; ++i)
     {
-        if (ProceduralMesh && ProceduralMesh->GetNumSections() > 0) ProceduralMesh->ClearMeshSection(0);
+        const FVector& Position = Positions[i];
+        FVector Direction = (i < NumRings - 1 ? Positions[i + 1] - Position : Position - Positions[i - 1]).GetSafeNormal();
+        if (Direction.IsNearlyZero()) Direction = PrevDirection_World;
+
+        // Across the line and across the view ray, so the ribbon shows its full width; looking straight along the line
+        // there is no such direction, and the previous particle's is kept.
+        FVector Side = FVector::CrossProduct(Direction, Inputs.ViewLocation - Position).GetSafeNormal();
+        if (Side.IsNearlyZero()) Side = PrevSide_World;
+        const FVector Normal = FVector::CrossProduct(Side, Direction).GetSafeNormal(); // Towards the view
+
+        CurrentV += (i > 0) ? FVector::Dist(Position, Positions[i - 1]) / FMath::Max(DesiredSegmentLength, 1.0f) : 0.0f;
+
+        const FVector LocalNormal = WorldToLocal.TransformVectorNoScale(Normal);
+        const FVector LocalTangent = WorldToLocal.TransformVectorNoScale(Direction);
+        for (int32 Edge = 0; Edge < 2; ++Edge)
+        {
+            const int32 VertexIndex = i * 2 + Edge;
+            OutMesh.Vertices[VertexIndex] = WorldToLocal.TransformPosition(Position + Side * (Edge == 0 ? -HalfWidth : HalfWidth));
+            OutMesh.Normals[VertexIndex] = LocalNormal;
+            OutMesh.Tangents[VertexIndex] = LocalTangent;
+            OutMesh.UVs[VertexIndex] = FVector2D(Edge, CurrentV);
+        }
+        PrevSide_World = Side;
+        PrevDirection_World = Direction;
     }
-    
-    if (LocalVertices.Num() > 0)
+
+    // Same winding as the tube's quads, without the wrap-around from the last side to the first.
+    if (OutMesh.TopologyRings != NumRings || !OutMesh.bRibbonTopology)
     {
-        FBox Box(ForceInit);
-        for(const FVector& P_Local : LocalVertices) Box += P_Local;
-        LocalBounds = FBoxSphereBounds(Box);
-    } else {
-        LocalBounds = FBoxSphereBounds(ForceInit);
+        OutMesh.Triangles.SetNumUninitialized((NumRings - 1) * 6);
+        int32* Index = OutMesh.Triangles.GetData();
+        for (int32 SegIdx = 0; SegIdx < NumRings - 1; ++SegIdx)
+        {
+            const int32 TL = SegIdx * 2;
+            const int32 TR = TL + 1;
+            const int32 BL = TL + 2;
+            const int32 BR = TL + 3;
+            *Index++ = TL; *Index++ = BL; *Index++ = TR;
+            *Index++ = TR; *Index++ = BL; *Index++ = BR;
+        }
+        OutMesh.TopologyRings = NumRings;
+        OutMesh.TopologySides = 2;
+        OutMesh.bRibbonTopology = true;
+    }
+}
+
+void UFishingLineComponent::ApplyCableMesh(const FFishingLineMeshData& Mesh)
+{
+    LocalBounds = Mesh.Vertices.Num() > 0 ? FBoxSphereBounds(Mesh.Bounds) : FBoxSphereBounds(ForceInit);
+
+    // The proxy takes the new vertices as dynamic data; its render state is left alone.
+    if (LineMesh)
+    {
+        if (LineMesh->GetMaterial(0) != CableMaterial)
+        {
+            LineMesh->SetMaterial(0, CableMaterial);
+        }
+        if (Mesh.Vertices.Num() > 0 && Mesh.Triangles.Num() > 0)
+        {
+            LineMesh->UpdateMesh(Mesh);
+        }
+        else
+        {
+            LineMesh->ClearMesh();
+        }
+        return;
+    }
+
+    if (!ProceduralMesh) return;
+
+    if (Mesh.Vertices.Num() > 0 && Mesh.Triangles.Num() > 0)
+    {
+        // Same vertex and index counts mean the same rings, so the section's indices still hold and only vertices are
+        // streamed. Anything else needs a new section, which recreates the mesh's render state.
+        const FProcMeshSection* Section = ProceduralMesh->GetProcMeshSection(0);
+        if (Section && Section->ProcVertexBuffer.Num() == Mesh.Vertices.Num() && Section->ProcIndexBuffer.Num() == Mesh.Triangles.Num())
+        {
+            ProceduralMesh->UpdateMeshSection(0, Mesh.Vertices, Mesh.Normals, Mesh.UVs, TArray<FColor>(), TArray<FProcMeshTangent>());
+        }
+        else
+        {
+            ProceduralMesh->CreateMeshSection(0, Mesh.Vertices, Mesh.Triangles, Mesh.Normals, Mesh.UVs, TArray<FColor>(), TArray<FProcMeshTangent>(), false);
+        }
+        if (ProceduralMesh->GetMaterial(0) != CableMaterial) ProceduralMesh->SetMaterial(0, CableMaterial);
+    }
+    else
+    {
+        if (ProceduralMesh->GetNumSections() > 0) ProceduralMesh->ClearMeshSection(0);
     }
-    MarkRenderStateDirty(); // Important to tell the rendering system that bounds or mesh changed
 }
 
 USceneComponent* UFishingLineComponent::GetResolvedAttachEndComponent() const
@@ -569,8 +1807,9 @@ FVector UFishingLineComponent::EvaluateCubicBezier(const FVector& P0, const FVec
     return Point;
 }
 
-void UFishingLineComponent::GeneratePointsOnBezier(TArray<FVector>& OutPoints, const FVector& P0_World, const FVector& P3_World, int32 PointsToGenerate)
+void UFishingLineComponent::GeneratePointsOnBezier(TArray<FVector>& OutPoints, const FVector& P0_World, const FVector& P3_World, const TArray<float>& CurveParams)
 {
+    const int32 PointsToGenerate = CurveParams.Num();
     OutPoints.Empty(PointsToGenerate);
     if (PointsToGenerate < 2)
     {
@@ -595,9 +1834,8 @@ void UFishingLineComponent::GeneratePointsOnBezier(TArray<FVector>& OutPoints, c
         P1_World += DownVector * SagOffsetDist * ExcessLengthFactor * 2.0f;
         P2_World += DownVector * SagOffsetDist * ExcessLengthFactor * 2.0f;
     }
-    for (int32 i = 0; i < PointsToGenerate; ++i)
+    for (const float t : CurveParams)
     {
-        float t = (PointsToGenerate > 1) ? (float)i / (float)(PointsToGenerate - 1) : 0.0f;
         OutPoints.Add(EvaluateCubicBezier(P0_World, P1_World, P2_World, P3_World, t));
     }
 }
\ No newline at end of file
@@ -0,0 +1,372 @@
+// FishingLineMeshComponent.cpp
+
+#include "FishingLineMeshComponent.h"
+#include "FishingLineComponent.h"
+#include "Engine/Engine.h"
+#include "LocalVertexFactory.h"
+#include "Materials/Material.h"
+#include "MaterialDomain.h"
+#include "PrimitiveSceneProxy.h"
+#include "SceneInterface.h"
+#include "SceneManagement.h"
+#include "StaticMeshResources.h"
+
+/** One frame of mesh, game thread to render thread. Indices are only filled when the topology changed. */
+struct FFishingLineDynamicData
+{
+    TArray<FVector3f> Vertices;
+    TArray<FVector3f> Normals;
+    TArray<FVector3f> Tangents;
+    TArray<FVector2f> UVs;
+    TArray<uint32> Indices;
+    int32 NumIndices = 0;
+};
+
+/**
+ * One vertex stream of the line, sized to the component's capacity. Rewritten every frame, so it is created dynamic
+ * and keeps no CPU copy; the proxy writes the used range straight into the locked buffer.
+ */
+class FFishingLineVertexBuffer final : public FVertexBuffer
+{
+public:
+    FFishingLineVertexBuffer(uint32 InStride, EPixelFormat InFormat)
+        : Stride(InStride)
+        , Format(InFormat)
+        , NumVertices(0)
+    {
+    }
+
+    virtual void InitRHI(FRHICommandListBase& RHICmdList) override
+    {
+        FRHIResourceCreateInfo CreateInfo(TEXT("FFishingLineVertexBuffer"));
+        VertexBufferRHI = RHICmdList.CreateVertexBuffer(Stride * NumVertices, BUF_Dynamic | BUF_ShaderResource, CreateInfo);
+        SRV = RHICmdList.CreateShaderResourceView(VertexBufferRHI, FRHIViewDesc::CreateBufferSRV().SetType(FRHIViewDesc::EBufferType::Typed).SetFormat(Format));
+    }
+
+    virtual void ReleaseRHI() override
+    {
+        SRV.SafeRelease();
+        FVertexBuffer::ReleaseRHI();
+    }
+
+    uint32 Stride;
+    EPixelFormat Format;
+    int32 NumVertices;
+    FShaderResourceViewRHIRef SRV;
+};
+
+/**
+ * The line's indices, sized to the component's capacity. Rewritten whenever the topology changes, which reeling and
+ * adaptive rings do often enough for it to be dynamic too.
+ */
+class FFishingLineIndexBuffer final : public FIndexBuffer
+{
+public:
+    virtual void InitRHI(FRHICommandListBase& RHICmdList) override
+    {
+        FRHIResourceCreateInfo CreateInfo(TEXT("FFishingLineIndexBuffer"));
+        IndexBufferRHI = RHICmdList.CreateIndexBuffer(sizeof(uint32), NumIndices * sizeof(uint32), BUF_Dynamic, CreateInfo);
+    }
+
+    int32 NumIndices = 0;
+};
+
+/** Persistent buffers sized by the component, rewritten in place from FFishingLineDynamicData. */
+class FFishingLineSceneProxy final : public FPrimitiveSceneProxy
+{
+public:
+    FFishingLineSceneProxy(UFishingLineMeshComponent* Component, int32 InVertexCapacity, int32 InIndexCapacity)
+        : FPrimitiveSceneProxy(Component)
+        , Material(Component->GetMaterial(0))
+        , MaterialRelevance(Component->GetMaterialRelevance(GetScene().GetFeatureLevel()))
+        , PositionBuffer(sizeof(FVector3f), PF_R32_FLOAT)
+        , TangentBuffer(2 * sizeof(FPackedNormal), PF_R8G8B8A8_SNORM)
+        , TexCoordBuffer(sizeof(FVector2f), PF_G32R32F)
+        , VertexFactory(GetScene().GetFeatureLevel(), "FFishingLineSceneProxy")
+        , NumVertices(0)
+        , NumIndices(0)
+    {
+        if (!Material)
+        {
+            Material = UMaterial::GetDefaultMaterial(MD_Surface);
+        }
+
+        PositionBuffer.NumVertices = InVertexCapacity;
+        TangentBuffer.NumVertices = InVertexCapacity;
+        TexCoordBuffer.NumVertices = InVertexCapacity;
+        IndexBuffer.NumIndices = InIndexCapacity;
+
+        ENQUEUE_RENDER_COMMAND(InitFishingLineVertexFactory)(
+            [this](FRHICommandListImmediate& RHICmdList)
+            {
+                PositionBuffer.InitResource(RHICmdList);
+                TangentBuffer.InitResource(RHICmdList);
+                TexCoordBuffer.InitResource(RHICmdList);
+                IndexBuffer.InitResource(RHICmdList);
+
+                FLocalVertexFactory::FDataType Data;
+                Data.PositionComponent = FVertexStreamComponent(&PositionBuffer, 0, PositionBuffer.Stride, VET_Float3);
+                Data.PositionComponentSRV = PositionBuffer.SRV;
+                Data.TangentBasisComponents[0] = FVertexStreamComponent(&TangentBuffer, 0, TangentBuffer.Stride, VET_PackedNormal);
+                Data.TangentBasisComponents[1] = FVertexStreamComponent(&TangentBuffer, sizeof(FPackedNormal), TangentBuffer.Stride, VET_PackedNormal);
+                Data.TangentsSRV = TangentBuffer.SRV;
+                Data.TextureCoordinates.Add(FVertexStreamComponent(&TexCoordBuffer, 0, TexCoordBuffer.Stride, VET_Float2));
+                Data.TextureCoordinatesSRV = TexCoordBuffer.SRV;
+                Data.NumTexCoords = 1;
+                Data.LightMapCoordinateIndex = 0;
+                // The line is never vertex-coloured, so it reads the shared white buffer instead of carrying its own.
+                FColorVertexBuffer::BindDefaultColorVertexBuffer(&VertexFactory, Data, FColorVertexBuffer::NullBindStride::ZeroForDefaultBufferBind);
+                VertexFactory.SetData(RHICmdList, Data);
+                VertexFactory.InitResource(RHICmdList);
+            });
+    }
+
+    virtual ~FFishingLineSceneProxy() override
+    {
+        PositionBuffer.ReleaseResource();
+        TangentBuffer.ReleaseResource();
+        TexCoordBuffer.ReleaseResource();
+        IndexBuffer.ReleaseResource();
+        VertexFactory.ReleaseResource();
+    }
+
+    virtual SIZE_T GetTypeHash() const override
+    {
+        static size_t UniquePointer;
+        return reinterpret_cast<size_t>(&UniquePointer);
+    }
+
+    void SetDynamicData_RenderThread(FRHICommandListBase& RHICmdList, const FFishingLineDynamicData& Data)
+    {
+        check(IsInRenderingThread());
+        check(Data.Vertices.Num() <= PositionBuffer.NumVertices && Data.NumIndices <= IndexBuffer.NumIndices);
+
+        NumVertices = Data.Vertices.Num();
+        NumIndices = Data.NumIndices;
+        if (NumVertices == 0) return;
+
+        // Only the used prefix of each buffer is locked and written; the rest of the capacity is never drawn.
+        void* PositionData = RHICmdList.LockBuffer(PositionBuffer.VertexBufferRHI, 0, NumVertices * PositionBuffer.Stride, RLM_WriteOnly);
+        FMemory::Memcpy(PositionData, Data.Vertices.GetData(), NumVertices * PositionBuffer.Stride);
+        RHICmdList.UnlockBuffer(PositionBuffer.VertexBufferRHI);
+
+        FPackedNormal* TangentData = static_cast<FPackedNormal*>(RHICmdList.LockBuffer(TangentBuffer.VertexBufferRHI, 0, NumVertices * TangentBuffer.Stride, RLM_WriteOnly));
+        for (int32 i = 0; i < NumVertices; ++i)
+        {
+            // TangentX, then TangentZ with the binormal sign in W, as FLocalVertexFactory reads them.
+            const FVector3f& Normal = Data.Normals[i];
+            const FVector3f& Tangent = Data.Tangents[i];
+            TangentData[2 * i] = FPackedNormal(Tangent);
+            TangentData[2 * i + 1] = FPackedNormal(FVector4f(Normal, GetBasisDeterminantSign(FVector3d(Tangent), FVector3d(FVector3f::CrossProduct(Normal, Tangent)), FVector3d(Normal))));
+        }
+        RHICmdList.UnlockBuffer(TangentBuffer.VertexBufferRHI);
+
+        void* TexCoordData = RHICmdList.LockBuffer(TexCoordBuffer.VertexBufferRHI, 0, NumVertices * TexCoordBuffer.Stride, RLM_WriteOnly);
+        FMemory::Memcpy(TexCoordData, Data.UVs.GetData(), NumVertices * TexCoordBuffer.Stride);
+        RHICmdList.UnlockBuffer(TexCoordBuffer.VertexBufferRHI);
+
+        if (Data.Indices.Num() > 0)
+        {
+            const uint32 IndexBytes = Data.Indices.Num() * sizeof(uint32);
+            void* IndexData = RHICmdList.LockBuffer(IndexBuffer.IndexBufferRHI, 0, IndexBytes, RLM_WriteOnly);
+            FMemory::Memcpy(IndexData, Data.Indices.GetData(), IndexBytes);
+            RHICmdList.UnlockBuffer(IndexBuffer.IndexBufferRHI);
+        }
+    }
+    virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(STAT_FishingLineSceneProxy_GetDynamicMeshElements);
+        if (NumIndices == 0) return;
+
+        const bool bWireframe = AllowDebugViewmodes() && ViewFamily.EngineShowFlags.Wireframe;
+        FMaterialRenderProxy* MaterialProxy = Material->GetRenderProxy();
+        if (bWireframe)
+        {
+            FColoredMaterialRenderProxy* WireframeMaterialInstance = new FColoredMaterialRenderProxy(
+                GEngine->WireframeMaterial ? GEngine->WireframeMaterial->GetRenderProxy() : nullptr, FLinearColor(0, 0.5f, 1.f));
+            Collector.RegisterOneFrameMaterialProxy(WireframeMaterialInstance);
+            MaterialProxy = WireframeMaterialInstance;
+        }
+
+        for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
+        {
+            if (!(VisibilityMap & (1 << ViewIndex))) continue;
+
+            FMeshBatch& Mesh = Collector.AllocateMesh();
+            FMeshBatchElement& BatchElement = Mesh.Elements[0];
+            BatchElement.IndexBuffer = &IndexBuffer;
+            Mesh.bWireframe = bWireframe;
+            Mesh.VertexFactory = &VertexFactory;
+            Mesh.MaterialRenderProxy = MaterialProxy;
+
+            bool bHasPrecomputedVolumetricLightmap;
+            FMatrix PreviousLocalToWorld;
+            int32 SingleCaptureIndex;
+            bool bOutputVelocity;
+            GetScene().GetPrimitiveUniformShaderParameters_RenderThread(GetPrimitiveSceneInfo(), bHasPrecomputedVolumetricLightmap, PreviousLocalToWorld, SingleCaptureIndex, bOutputVelocity);
+            bOutputVelocity |= AlwaysHasVelocity();
+
+            FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer = Collector.AllocateOneFrameResource<FDynamicPrimitiveUniformBuffer>();
+            DynamicPrimitiveUniformBuffer.Set(Collector.GetRHICommandList(), GetLocalToWorld(), PreviousLocalToWorld, GetBounds(), GetLocalBounds(), true, bHasPrecomputedVolumetricLightmap, bOutputVelocity);
+            BatchElement.PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
+
+            BatchElement.FirstIndex = 0;
+            BatchElement.NumPrimitives = NumIndices / 3;
+            BatchElement.MinVertexIndex = 0;
+            BatchElement.MaxVertexIndex = NumVertices - 1;
+            Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
+            Mesh.Type = PT_TriangleList;
+            Mesh.DepthPriorityGroup = SDPG_World;
+            Mesh.bCanApplyViewModeOverrides = false;
+            Collector.AddMesh(ViewIndex, Mesh);
+        }
+    }
+
+    virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override
+    {
+        FPrimitiveViewRelevance Result;
+        Result.bDrawRelevance = IsShown(View);
+        Result.bShadowRelevance = IsShadowCast(View);
+        Result.bDynamicRelevance = true;
+        MaterialRelevance.SetPrimitiveViewRelevance(Result);
+        Result.bVelocityRelevance = DrawsVelocity() && Result.bOpaque && Result.bRenderInMainPass;
+        return Result;
+    }
+
+    virtual uint32 GetMemoryFootprint() const override { return sizeof(*this) + GetAllocatedSize(); }
+
+private:
+    UMaterialInterface* Material;
+    FMaterialRelevance MaterialRelevance;
+    FFishingLineVertexBuffer PositionBuffer;
+    FFishingLineVertexBuffer TangentBuffer;
+    FFishingLineVertexBuffer TexCoordBuffer;
+    FFishingLineIndexBuffer IndexBuffer;
+    FLocalVertexFactory VertexFactory;
+    /** Used prefix of the buffers, as of the last dynamic data. */
+    int32 NumVertices;
+    int32 NumIndices;
+};
+
+UFishingLineMeshComponent::UFishingLineMeshComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+    SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    SetGenerateOverlapEvents(false);
+
+    MeshBounds = FBox(ForceInit);
+    VertexCapacity = 0;
+    IndexCapacity = 0;
+    bIndicesDirty = false;
+}
+
+void UFishingLineMeshComponent::UpdateMesh(const FFishingLineMeshData& Mesh)
+{
+    const int32 NumVertices = Mesh.Vertices.Num();
+    const int32 NumIndices = Mesh.Triangles.Num();
+
+    // Indices go to the proxy only when they differ; the comparison is far cheaper than the upload it saves.
+    static_assert(sizeof(Mesh.Triangles[0]) == sizeof(uint32), "Triangles and Indices are compared bitwise");
+    if (NumIndices != Indices.Num() || FMemory::Memcmp(Indices.GetData(), Mesh.Triangles.GetData(), NumIndices * sizeof(uint32)) != 0)
+    {
+        Indices.SetNumUninitialized(NumIndices);
+        for (int32 i = 0; i < NumIndices; ++i)
+        {
+            Indices[i] = static_cast<uint32>(Mesh.Triangles[i]);
+        }
+        bIndicesDirty = true;
+    }
+
+    Vertices.SetNumUninitialized(NumVertices);
+    Normals.SetNumUninitialized(NumVertices);
+    Tangents.SetNumUninitialized(NumVertices);
+    UVs.SetNumUninitialized(NumVertices);
+    for (int32 i = 0; i < NumVertices; ++i)
+    {
+        Vertices[i] = FVector3f(Mesh.Vertices[i]);
+        Normals[i] = FVector3f(Mesh.Normals[i]);
+        Tangents[i] = FVector3f(Mesh.Tangents[i]);
+        UVs[i] = FVector2f(Mesh.UVs[i]);
+    }
+    MeshBounds = Mesh.Bounds;
+
+    if (NumVertices > VertexCapacity || NumIndices > IndexCapacity)
+    {
+        // Headroom, so a line being reeled in or paid out does not recreate its proxy for every segment.
+        VertexCapacity = FMath::RoundUpToPowerOfTwo(NumVertices);
+        IndexCapacity = FMath::RoundUpToPowerOfTwo(NumIndices);
+        MarkRenderStateDirty();
+    }
+    else
+    {
+        MarkRenderDynamicDataDirty();
+    }
+    // New bounds; the transform has not moved, so nothing else would send them to the proxy.
+    UpdateBounds();
+    MarkRenderTransformDirty();
+}
+
+void UFishingLineMeshComponent::ClearMesh()
+{
+    if (Vertices.Num() == 0) return;
+
+    Vertices.Reset();
+    Normals.Reset();
+    Tangents.Reset();
+    UVs.Reset();
+    Indices.Reset();
+    MeshBounds = FBox(ForceInit);
+    bIndicesDirty = true;
+    MarkRenderDynamicDataDirty();
+    UpdateBounds();
+    MarkRenderTransformDirty();
+}
+
+FPrimitiveSceneProxy* UFishingLineMeshComponent::CreateSceneProxy()
+{
+    if (VertexCapacity == 0 || IndexCapacity == 0) return nullptr;
+    return new FFishingLineSceneProxy(this, VertexCapacity, IndexCapacity);
+}
+
+void UFishingLineMeshComponent::CreateRenderState_Concurrent(FRegisterComponentContext* Context)
+{
+    Super::CreateRenderState_Concurrent(Context);
+
+    // A new proxy starts from empty buffers and needs the whole mesh, indices included.
+    bIndicesDirty = true;
+    SendRenderDynamicData_Concurrent();
+}
+
+void UFishingLineMeshComponent::SendRenderDynamicData_Concurrent()
+{
+    Super::SendRenderDynamicData_Concurrent();
+    if (!SceneProxy) return;
+
+    FFishingLineDynamicData DynamicData;
+    DynamicData.Vertices = Vertices;
+    DynamicData.Normals = Normals;
+    DynamicData.Tangents = Tangents;
+    DynamicData.UVs = UVs;
+    DynamicData.NumIndices = Indices.Num();
+    if (bIndicesDirty)
+    {
+        DynamicData.Indices = Indices;
+        bIndicesDirty = false;
+    }
+
+    FFishingLineSceneProxy* LineSceneProxy = static_cast<FFishingLineSceneProxy*>(SceneProxy);
+    ENQUEUE_RENDER_COMMAND(FSendFishingLineDynamicData)(
+        [LineSceneProxy, DynamicData = MoveTemp(DynamicData)](FRHICommandListImmediate& RHICmdList)
+        {
+            LineSceneProxy->SetDynamicData_RenderThread(RHICmdList, DynamicData);
+        });
+}
+
+FBoxSphereBounds UFishingLineMeshComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+    if (MeshBounds.IsValid)
+    {
+        return FBoxSphereBounds(MeshBounds).TransformBy(LocalToWorld);
+    }
+    return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector::ZeroVector, 0.0f);
+}
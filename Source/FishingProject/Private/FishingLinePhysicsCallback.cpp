@@ -0,0 +1,44 @@
+// FishingLinePhysicsCallback.cpp
+
+#include "FishingLinePhysicsCallback.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+
+void FFishingLinePhysicsCallback::OnPreSimulate_Internal()
+{
+    const FFishingLinePhysicsInput* Input = GetConsumerInput_Internal();
+    if (!Input || !Input->bSimulate) return;
+
+    FScopeLock Lock(&LineLock);
+    if (!Line) return;
+
+    FFishingLineStepInputs StepInputs = Input->StepInputs;
+    StepInputs.DeltaTime = GetDeltaTime_Internal();
+    if (EndBodyProxy && StepInputs.bEndAttached)
+    {
+        if (const Chaos::FRigidBodyHandle_Internal* EndBody = EndBodyProxy->GetPhysicsThreadAPI())
+        {
+            StepInputs.EndLocation = FVector(EndBody->GetX());
+            StepInputs.bEndLocationIsCurrent = true;
+        }
+    }
+
+    // One input covers a game frame of anchor motion, which the physics steps consuming it share out by their time, the
+    // way fixed steps do within a frame. Time the steps overrun the frame by goes straight to the target.
+    if (Input->Serial != ConsumedInputSerial)
+    {
+        ConsumedInputSerial = Input->Serial;
+        ConsumedInputTime = 0.0f;
+    }
+    const float RemainingInputTime = Input->StepInputs.DeltaTime - ConsumedInputTime;
+    const float AnchorAlpha = RemainingInputTime > StepInputs.DeltaTime ? StepInputs.DeltaTime / RemainingInputTime : 1.0f;
+    ConsumedInputTime += StepInputs.DeltaTime;
+
+    // Always a single variable step: the physics step already is the fixed step, so bUseFixedTimestep does not apply here.
+    Line->AdvanceSimulation(StepInputs, false, AnchorAlpha);
+
+    FFishingLinePhysicsOutput& Output = GetProducerOutputData_Internal();
+    Output.StepInputs = StepInputs;
+    Output.Positions = Line->GetSimulatedRenderPositions();
+    Output.SolverIterations = Line->FrameSolverIterations;
+    Output.SolverResidual = Line->FrameSolverResidual;
+}
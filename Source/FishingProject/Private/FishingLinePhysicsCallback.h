@@ -0,0 +1,73 @@
+// FishingLinePhysicsCallback.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "FishingLineComponent.h"
+
+class FSingleParticlePhysicsProxy;
+
+/** Game thread to physics thread, once per frame. */
+struct FFishingLinePhysicsInput : public Chaos::FSimCallbackInput
+{
+    FFishingLineStepInputs StepInputs;
+    /** False while the line has nothing to step (asleep, too short); the physics steps then leave it alone. */
+    bool bSimulate = false;
+    /** Numbers the game frames, so the physics steps can tell when they have moved on to a new input. */
+    uint32 Serial = 0;
+
+    void Reset()
+    {
+        StepInputs = FFishingLineStepInputs();
+        bSimulate = false;
+        Serial = 0;
+    }
+};
+
+/** Physics thread to game thread, once per physics step. */
+struct FFishingLinePhysicsOutput : public Chaos::FSimCallbackOutput
+{
+    /** Inputs the step ran with, anchors included, so the game thread meshes the result in the same frame of reference. */
+    FFishingLineStepInputs StepInputs;
+    TArray<FVector> Positions;
+    int32 SolverIterations = 0;
+    float SolverResidual = 0.0f;
+
+    void Reset()
+    {
+        Positions.Reset();
+        SolverIterations = 0;
+        SolverResidual = 0.0f;
+    }
+};
+
+/**
+ * Steps one UFishingLineComponent from inside the Chaos solver, before each physics (sub)step, so the line advances at
+ * the rate of the bodies it is attached to. Created and unregistered by the component (bSimulateInPhysicsThread).
+ * LineLock guards the line's simulation-side state: the physics steps hold it while stepping, and the game thread holds
+ * it while preparing inputs and publishing results.
+ */
+class FFishingLinePhysicsCallback : public Chaos::TSimCallbackObject<FFishingLinePhysicsInput, FFishingLinePhysicsOutput>
+{
+public:
+    /** Cleared under LineLock before unregistering, so a step the solver has already queued does nothing. */
+    UFishingLineComponent* Line = nullptr;
+    /**
+     * Body a pinned end follows; its physics-thread position replaces StepInputs.EndLocation on every step. Guarded by
+     * LineLock rather than passed in the input, so the game thread can clear it as soon as the body's physics state is
+     * destroyed, before the solver frees the proxy, instead of steps still reading it from an input already sent.
+     */
+    FSingleParticlePhysicsProxy* EndBodyProxy = nullptr;
+    FCriticalSection LineLock;
+    /** Serial of the last input produced. Game thread only. */
+    uint32 ProducedInputSerial = 0;
+
+private:
+    virtual void OnPreSimulate_Internal() override;
+
+    /** Input the last physics step consumed, and the simulation time spent on it so far. Physics thread only. */
+    uint32 ConsumedInputSerial = 0;
+    float ConsumedInputTime = 0.0f;
+};
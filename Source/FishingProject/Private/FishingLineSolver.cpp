@@ -0,0 +1,570 @@
+// FishingLineSolver.cpp
+
+#include "FishingLineSolver.h"
+#include "FishingLineComponent.h"
+#include "Math/VectorRegister.h"
+#include "Async/ParallelFor.h"
+
+#if INTEL_ISPC
+#include "FishingLineSolver.ispc.generated.h"
+#endif
+
+static_assert(sizeof(FVector3f) == 3 * sizeof(float), "IntegrateVectorized and the ISPC kernel treat FVector3f arrays as packed floats.");
+
+void FishingLineSolver::Integrate(FFishingLineParticles& Particles, int32 StartIndex, int32 EndIndex, float DeltaTime, float DampingFactor, const FVector3f& Gravity)
+{
+    StartIndex = FMath::Max(StartIndex, 0);
+    EndIndex = FMath::Min(EndIndex, Particles.Num());
+    if (StartIndex >= EndIndex) return;
+
+    FVector3f* RESTRICT Positions = Particles.Positions.GetData();
+    FVector3f* RESTRICT OldPositions = Particles.OldPositions.GetData();
+    FVector3f* RESTRICT Accelerations = Particles.Accelerations.GetData();
+    const uint8* RESTRICT Flags = Particles.Flags.GetData();
+
+    const float DeltaTimeSq = DeltaTime * DeltaTime;
+    const float VelocityScale = 1.0f - DampingFactor;
+
+    for (int32 i = StartIndex; i < EndIndex; ++i)
+    {
+        if ((Flags[i] & FFishingLineParticles::Flag_Fixed) == 0)
+        {
+            const FVector3f Velocity = Positions[i] - OldPositions[i];
+            OldPositions[i] = Positions[i];
+            Positions[i] += Velocity * VelocityScale + (Accelerations[i] + Gravity) * DeltaTimeSq;
+        }
+        Accelerations[i] = FVector3f::ZeroVector;
+    }
+}
+
+void FishingLineSolver::IntegrateVectorized(FFishingLineParticles& Particles, int32 StartIndex, int32 EndIndex, float DeltaTime, float DampingFactor, const FVector3f& Gravity)
+{
+    StartIndex = FMath::Max(StartIndex, 0);
+    EndIndex = FMath::Min(EndIndex, Particles.Num());
+    if (StartIndex >= EndIndex) return;
+
+    // Four particles are twelve packed floats, i.e. three registers per attribute. Lane k of register R holds
+    // component (4R + k) % 3 of particle (4R + k) / 3, which is why gravity and the fixed weights are pre-swizzled.
+    const int32 NumBatches = (EndIndex - StartIndex) / 4;
+
+    float* RESTRICT Positions = &Particles.Positions[StartIndex].X;
+    float* RESTRICT OldPositions = &Particles.OldPositions[StartIndex].X;
+    float* RESTRICT Accelerations = &Particles.Accelerations[StartIndex].X;
+    const uint8* RESTRICT Flags = Particles.Flags.GetData() + StartIndex;
+
+    const float DeltaTimeSq = DeltaTime * DeltaTime;
+    const float VelocityScale = 1.0f - DampingFactor;
+    const VectorRegister4Float DeltaTimeSqReg = VectorSetFloat1(DeltaTimeSq);
+    const VectorRegister4Float VelocityScaleReg = VectorSetFloat1(VelocityScale);
+    const VectorRegister4Float GravityReg[3] = {
+        MakeVectorRegisterFloat(Gravity.X, Gravity.Y, Gravity.Z, Gravity.X),
+        MakeVectorRegisterFloat(Gravity.Y, Gravity.Z, Gravity.X, Gravity.Y),
+        MakeVectorRegisterFloat(Gravity.Z, Gravity.X, Gravity.Y, Gravity.Z)
+    };
+    const VectorRegister4Float Zero = VectorZeroFloat();
+
+    for (int32 Batch = 0; Batch < NumBatches; ++Batch)
+    {
+        // Flag_Fixed is bit 0, so this is 0 for fixed particles and 1 for free ones.
+        const uint8* BatchFlags = Flags + Batch * 4;
+        const float W0 = float(1 - (BatchFlags[0] & FFishingLineParticles::Flag_Fixed));
+        const float W1 = float(1 - (BatchFlags[1] & FFishingLineParticles::Flag_Fixed));
+        const float W2 = float(1 - (BatchFlags[2] & FFishingLineParticles::Flag_Fixed));
+        const float W3 = float(1 - (BatchFlags[3] & FFishingLineParticles::Flag_Fixed));
+        const VectorRegister4Float FreeWeight[3] = {
+            MakeVectorRegisterFloat(W0, W0, W0, W1),
+            MakeVectorRegisterFloat(W1, W1, W2, W2),
+            MakeVectorRegisterFloat(W2, W3, W3, W3)
+        };
+
+        const int32 BaseOffset = Batch * 12;
+        for (int32 Reg = 0; Reg < 3; ++Reg)
+        {
+            float* P = Positions + BaseOffset + Reg * 4;
+            float* O = OldPositions + BaseOffset + Reg * 4;
+            float* A = Accelerations + BaseOffset + Reg * 4;
+
+            const VectorRegister4Float Pos = VectorLoad(P);
+            const VectorRegister4Float OldPos = VectorLoad(O);
+            const VectorRegister4Float Accel = VectorAdd(VectorLoad(A), GravityReg[Reg]);
+            const VectorRegister4Float Velocity = VectorSubtract(Pos, OldPos);
+            const VectorRegister4Float Step = VectorAdd(VectorMultiply(Velocity, VelocityScaleReg), VectorMultiply(Accel, DeltaTimeSqReg));
+
+            // Free: Old = Pos, Pos += Step. Fixed: both unchanged.
+            VectorStore(VectorMultiplyAdd(FreeWeight[Reg], Velocity, OldPos), O);
+            VectorStore(VectorMultiplyAdd(FreeWeight[Reg], Step, Pos), P);
+            VectorStore(Zero, A);
+        }
+    }
+
+    Integrate(Particles, StartIndex + NumBatches * 4, EndIndex, DeltaTime, DampingFactor, Gravity);
+}
+
+namespace FishingLineSolver
+{
+    /**
+     * Projects segment i (particles i and i + 1) and returns its relative length error before the projection, i.e. the
+     * correction it called for. Shared by the sequential and block sweeps.
+     */
+    static FORCEINLINE float ProjectSegment(FVector3f* RESTRICT Positions, const uint8* RESTRICT Flags, int32 i, float RestLength, float Stiffness)
+    {
+        const FVector3f Delta = Positions[i + 1] - Positions[i];
+        const float CurrentLength = Delta.Size();
+
+        if (CurrentLength < KINDA_SMALL_NUMBER) return RestLength > 0.0f ? 1.0f : 0.0f;
+
+        const float Error = CurrentLength - RestLength;
+        const FVector3f Correction = (Delta / CurrentLength) * Error * Stiffness;
+
+        const bool bP1IsFixed = (Flags[i] & FFishingLineParticles::Flag_Fixed) != 0;
+        const bool bP2IsFixed = (Flags[i + 1] & FFishingLineParticles::Flag_Fixed) != 0;
+
+        float P1_MoveRatio, P2_MoveRatio;
+        if (bP1IsFixed && bP2IsFixed) { P1_MoveRatio = 0.0f; P2_MoveRatio = 0.0f; }
+        else if (bP1IsFixed) { P1_MoveRatio = 0.0f; P2_MoveRatio = 1.0f; }
+        else if (bP2IsFixed) { P1_MoveRatio = 1.0f; P2_MoveRatio = 0.0f; }
+        else { P1_MoveRatio = 0.5f; P2_MoveRatio = 0.5f; }
+
+        if (P1_MoveRatio > 0.0f)
+        {
+            Positions[i] += Correction * P1_MoveRatio;
+        }
+        if (P2_MoveRatio > 0.0f)
+        {
+            Positions[i + 1] -= Correction * P2_MoveRatio;
+        }
+        return RestLength > 0.0f ? FMath::Abs(Error) / RestLength : 0.0f;
+    }
+}
+
+namespace FishingLineSolver
+{
+    /** Pulls particles A and B together until they are at most MaxLength apart. Fixed ends do not move. */
+    static FORCEINLINE void ProjectMaxDistance(FVector3f* RESTRICT Positions, const uint8* RESTRICT Flags, int32 A, int32 B, float MaxLength)
+    {
+        const FVector3f Delta = Positions[B] - Positions[A];
+        const float LengthSquared = Delta.SizeSquared();
+        if (LengthSquared <= MaxLength * MaxLength) return;
+
+        const bool bAIsFixed = (Flags[A] & FFishingLineParticles::Flag_Fixed) != 0;
+        const bool bBIsFixed = (Flags[B] & FFishingLineParticles::Flag_Fixed) != 0;
+        if (bAIsFixed && bBIsFixed) return;
+
+        const float CurrentLength = FMath::Sqrt(LengthSquared);
+        const FVector3f Correction = Delta * ((CurrentLength - MaxLength) / CurrentLength);
+        const float ARatio = bAIsFixed ? 0.0f : (bBIsFixed ? 1.0f : 0.5f);
+        Positions[A] += Correction * ARatio;
+        Positions[B] -= Correction * (1.0f - ARatio);
+    }
+}
+
+float FishingLineSolver::SolveDistanceConstraints(FFishingLineParticles& Particles, int32 Iterations, float Stiffness)
+{
+    const int32 NumSegments = Particles.Num() - 1;
+    if (NumSegments < 1) return 0.0f;
+
+    FVector3f* RESTRICT Positions = Particles.Positions.GetData();
+    const uint8* RESTRICT Flags = Particles.Flags.GetData();
+    const float* RESTRICT RestLengths = Particles.RestLengths.GetData();
+
+    float MaxError = 0.0f;
+    for (int32 Iter = 0; Iter < Iterations; ++Iter)
+    {
+        MaxError = 0.0f;
+        for (int32 i = 0; i < NumSegments; ++i)
+        {
+            MaxError = FMath::Max(MaxError, ProjectSegment(Positions, Flags, i, RestLengths[i], Stiffness));
+        }
+    }
+    return MaxError;
+}
+
+float FishingLineSolver::SolveDistanceConstraintsParallel(FFishingLineParticles& Particles, int32 Iterations, float Stiffness, int32 SegmentsPerTask)
+{
+    const int32 NumSegments = Particles.Num() - 1;
+    if (NumSegments < 1 || Iterations < 1) return 0.0f;
+
+    FVector3f* Positions = Particles.Positions.GetData();
+    const uint8* Flags = Particles.Flags.GetData();
+    const float* RestLengths = Particles.RestLengths.GetData();
+    SegmentsPerTask = FMath::Max(SegmentsPerTask, 2);
+
+    // A task per dispatch rather than per sweep and colour: dispatching costs more than a small block's sweeps.
+    // A single sweep has no second round to shift the seams into; it projects them itself after its one dispatch, so
+    // a call always runs exactly Iterations sweeps.
+    const int32 NumRounds = Iterations >= 2 ? 2 : 1;
+    const int32 SweepsPerRound[2] = { (Iterations + 1) / 2, Iterations / 2 };
+    TArray<float, TInlineAllocator<64>> BlockErrors;
+    float MaxError = 0.0f;
+    for (int32 Round = 0; Round < NumRounds; ++Round)
+    {
+        const int32 Offset = Round * (SegmentsPerTask / 2);
+        const int32 NumBlocks = FMath::DivideAndRoundUp(NumSegments + Offset, SegmentsPerTask);
+        const int32 Sweeps = SweepsPerRound[Round];
+        BlockErrors.SetNumUninitialized(NumBlocks);
+        float* BlockErrorData = BlockErrors.GetData();
+
+        ParallelFor(NumBlocks, [=](int32 Block)
+        {
+            const int32 First = FMath::Max(Block * SegmentsPerTask - Offset, 0);
+            const int32 BlockEnd = FMath::Min((Block + 1) * SegmentsPerTask - Offset, NumSegments);
+            // The last segment shares its far particle with the next block; the line's last segment has no next block.
+            const int32 Last = BlockEnd < NumSegments ? BlockEnd - 1 : BlockEnd;
+            float BlockError = 0.0f;
+            for (int32 Sweep = 0; Sweep < Sweeps; ++Sweep)
+            {
+                BlockError = 0.0f;
+                for (int32 i = First; i < Last; ++i)
+                {
+                    BlockError = FMath::Max(BlockError, ProjectSegment(Positions, Flags, i, RestLengths[i], Stiffness));
+                }
+            }
+            BlockErrorData[Block] = BlockError;
+        });
+
+        // Only the last round's corrections are current; the first round's have been worked on since.
+        MaxError = 0.0f;
+        for (float BlockError : BlockErrors)
+        {
+            MaxError = FMath::Max(MaxError, BlockError);
+        }
+        if (NumRounds == 1)
+        {
+            for (int32 Block = 1; Block < NumBlocks; ++Block)
+            {
+                const int32 Seam = Block * SegmentsPerTask - 1;
+                MaxError = FMath::Max(MaxError, ProjectSegment(Positions, Flags, Seam, RestLengths[Seam], Stiffness));
+            }
+        }
+    }
+    return MaxError;
+}
+
+void FishingLineSolver::SolveDistanceConstraintsDirect(FFishingLineParticles& Particles, FFishingLineSolverScratch& Scratch, int32 Passes)
+{
+    const int32 NumSegments = Particles.Num() - 1;
+    if (NumSegments < 1) return;
+
+    Scratch.SetNumSegments(NumSegments);
+
+    FVector3f* RESTRICT Positions = Particles.Positions.GetData();
+    const float* RESTRICT InverseMasses = Particles.InverseMasses.GetData();
+    const uint8* RESTRICT Flags = Particles.Flags.GetData();
+    const float* RESTRICT RestLengths = Particles.RestLengths.GetData();
+    FVector3f* RESTRICT Directions = Scratch.Directions.GetData();
+    double* RESTRICT Diagonal = Scratch.Diagonal.GetData();
+    double* RESTRICT Upper = Scratch.Upper.GetData();
+    double* RESTRICT UpperPrime = Scratch.UpperPrime.GetData();
+    double* RESTRICT Rhs = Scratch.Rhs.GetData();
+    double* RESTRICT Lambdas = Scratch.Lambdas.GetData();
+
+    auto GetWeight = [InverseMasses, Flags](int32 Index) -> double
+    {
+        return (Flags[Index] & FFishingLineParticles::Flag_Fixed) ? 0.0 : double(InverseMasses[Index]);
+    };
+
+    for (int32 Pass = 0; Pass < Passes; ++Pass)
+    {
+        // Assemble. A segment that is degenerate or has both ends fixed becomes an identity row with no coupling.
+        // Positions are single precision, but the elimination runs in double: pivots lose digits along a long chain.
+        for (int32 j = 0; j < NumSegments; ++j)
+        {
+            const FVector3f Delta = Positions[j + 1] - Positions[j];
+            const float CurrentLength = Delta.Size();
+            const double WeightSum = GetWeight(j) + GetWeight(j + 1);
+
+            if (CurrentLength < KINDA_SMALL_NUMBER || WeightSum <= 0.0)
+            {
+                Directions[j] = FVector3f::ZeroVector;
+                Diagonal[j] = 1.0;
+                Rhs[j] = 0.0;
+            }
+            else
+            {
+                Directions[j] = Delta / CurrentLength;
+                Diagonal[j] = WeightSum;
+                Rhs[j] = RestLengths[j] - CurrentLength;
+            }
+        }
+        for (int32 j = 0; j < NumSegments - 1; ++j)
+        {
+            // Neighbouring constraints share particle j + 1.
+            Upper[j] = -GetWeight(j + 1) * FVector3f::DotProduct(Directions[j], Directions[j + 1]);
+        }
+
+        // Thomas algorithm: forward elimination then back substitution. The matrix is symmetric, so the sub-diagonal is Upper shifted by one.
+        UpperPrime[0] = (NumSegments > 1) ? Upper[0] / Diagonal[0] : 0.0;
+        Rhs[0] /= Diagonal[0];
+        for (int32 j = 1; j < NumSegments; ++j)
+        {
+            const double Pivot = Diagonal[j] - Upper[j - 1] * UpperPrime[j - 1];
+            UpperPrime[j] = (j < NumSegments - 1) ? Upper[j] / Pivot : 0.0;
+            Rhs[j] = (Rhs[j] - Upper[j - 1] * Rhs[j - 1]) / Pivot;
+        }
+        Lambdas[NumSegments - 1] = Rhs[NumSegments - 1];
+        for (int32 j = NumSegments - 2; j >= 0; --j)
+        {
+            Lambdas[j] = Rhs[j] - UpperPrime[j] * Lambdas[j + 1];
+        }
+
+        // dx_i = w_i * (lambda_i-1 * n_i-1 - lambda_i * n_i)
+        for (int32 i = 0; i <= NumSegments; ++i)
+        {
+            const double Weight = GetWeight(i);
+            if (Weight <= 0.0) continue;
+
+            FVector3f Correction = FVector3f::ZeroVector;
+            if (i > 0) Correction += Directions[i - 1] * float(Lambdas[i - 1] * Weight);
+            if (i < NumSegments) Correction -= Directions[i] * float(Lambdas[i] * Weight);
+            Positions[i] += Correction;
+        }
+    }
+}
+
+void FishingLineSolver::SolveDistanceConstraintsXPBD(FFishingLineParticles& Particles, FFishingLineSolverScratch& Scratch, int32 Iterations, float Compliance, float DeltaTime, bool bResetMultipliers)
+{
+    const int32 NumSegments = Particles.Num() - 1;
+    if (NumSegments < 1 || DeltaTime <= 0.f) return;
+
+    if (bResetMultipliers || Scratch.Lambdas.Num() != NumSegments)
+    {
+        Scratch.SetNumSegments(NumSegments);
+        FMemory::Memzero(Scratch.Lambdas.GetData(), NumSegments * sizeof(double));
+    }
+
+    FVector3f* RESTRICT Positions = Particles.Positions.GetData();
+    const float* RESTRICT InverseMasses = Particles.InverseMasses.GetData();
+    const uint8* RESTRICT Flags = Particles.Flags.GetData();
+    const float* RESTRICT RestLengths = Particles.RestLengths.GetData();
+    double* RESTRICT Lambdas = Scratch.Lambdas.GetData();
+
+    const double AlphaTilde = double(Compliance) / (double(DeltaTime) * DeltaTime);
+
+    for (int32 Iter = 0; Iter < Iterations; ++Iter)
+    {
+        for (int32 i = 0; i < NumSegments; ++i)
+        {
+            const double W1 = (Flags[i] & FFishingLineParticles::Flag_Fixed) ? 0.0 : double(InverseMasses[i]);
+            const double W2 = (Flags[i + 1] & FFishingLineParticles::Flag_Fixed) ? 0.0 : double(InverseMasses[i + 1]);
+            const double Denominator = W1 + W2 + AlphaTilde;
+            if (Denominator <= 0.0) continue;
+
+            const FVector3f Delta = Positions[i + 1] - Positions[i];
+            const float CurrentLength = Delta.Size();
+            if (CurrentLength < KINDA_SMALL_NUMBER) continue;
+
+            const double Constraint = CurrentLength - RestLengths[i];
+            const double DeltaLambda = (-Constraint - AlphaTilde * Lambdas[i]) / Denominator;
+            Lambdas[i] += DeltaLambda;
+
+            // Gradient of C is -n for the first particle and +n for the second.
+            const FVector3f Direction = Delta / CurrentLength;
+            Positions[i] -= Direction * float(DeltaLambda * W1);
+            Positions[i + 1] += Direction * float(DeltaLambda * W2);
+        }
+    }
+}
+
+void FishingLineSolver::SolveCoarseLevels(FFishingLineParticles& Particles, FFishingLineSolverScratch& Scratch, int32 NumLevels, int32 CoarseningFactor, int32 Iterations)
+{
+    const int32 NumSegments = Particles.Num() - 1;
+    if (NumSegments < 2 || NumLevels < 2 || CoarseningFactor < 2 || Iterations < 1) return;
+
+    FVector3f* RESTRICT Positions = Particles.Positions.GetData();
+    const uint8* RESTRICT Flags = Particles.Flags.GetData();
+    const float* RESTRICT RestLengths = Particles.RestLengths.GetData();
+
+    Scratch.ArcLengths.SetNumUninitialized(NumSegments + 1, EAllowShrinking::No);
+    float* RESTRICT ArcLengths = Scratch.ArcLengths.GetData();
+    ArcLengths[0] = 0.0f;
+    for (int32 i = 0; i < NumSegments; ++i)
+    {
+        ArcLengths[i + 1] = ArcLengths[i] + RestLengths[i];
+    }
+
+    int32 Stride = 1;
+    for (int32 Level = 1; Level < NumLevels; ++Level)
+    {
+        Stride *= CoarseningFactor;
+    }
+
+    for (; Stride > 1; Stride /= CoarseningFactor)
+    {
+        // A chain of one segment has no low-frequency error to remove; tethers cover that case.
+        const int32 NumCoarseSegments = FMath::DivideAndRoundUp(NumSegments, Stride);
+        if (NumCoarseSegments < 2) continue;
+
+        auto GetNode = [Stride, NumSegments](int32 Coarse) { return FMath::Min(Coarse * Stride, NumSegments); };
+
+        Scratch.CoarsePositions.SetNumUninitialized(NumCoarseSegments + 1, EAllowShrinking::No);
+        FVector3f* RESTRICT CoarsePositions = Scratch.CoarsePositions.GetData();
+        for (int32 c = 0; c <= NumCoarseSegments; ++c)
+        {
+            CoarsePositions[c] = Positions[GetNode(c)];
+        }
+
+        for (int32 Iter = 0; Iter < Iterations; ++Iter)
+        {
+            for (int32 c = 0; c < NumCoarseSegments; ++c)
+            {
+                const int32 A = GetNode(c);
+                const int32 B = GetNode(c + 1);
+                ProjectMaxDistance(Positions, Flags, A, B, ArcLengths[B] - ArcLengths[A]);
+            }
+        }
+
+        // Prolongation: the particles between two nodes move with them, weighted by how far along the span they sit.
+        for (int32 c = 0; c < NumCoarseSegments; ++c)
+        {
+            const int32 A = GetNode(c);
+            const int32 B = GetNode(c + 1);
+            const FVector3f DeltaA = Positions[A] - CoarsePositions[c];
+            const FVector3f DeltaB = Positions[B] - CoarsePositions[c + 1];
+            if (DeltaA.IsZero() && DeltaB.IsZero()) continue;
+
+            const float InvSpan = 1.0f / FMath::Max(ArcLengths[B] - ArcLengths[A], UE_KINDA_SMALL_NUMBER);
+            for (int32 i = A + 1; i < B; ++i)
+            {
+                if (Flags[i] & FFishingLineParticles::Flag_Fixed) continue;
+                Positions[i] += FMath::Lerp(DeltaA, DeltaB, (ArcLengths[i] - ArcLengths[A]) * InvSpan);
+            }
+        }
+    }
+}
+
+void FishingLineSolver::ApplyLongRangeAttachments(FFishingLineParticles& Particles, int32 AnchorIndex)
+{
+    const int32 NumPoints = Particles.Num();
+    if (NumPoints < 2) return;
+    check(AnchorIndex == 0 || AnchorIndex == NumPoints - 1);
+
+    FVector3f* RESTRICT Positions = Particles.Positions.GetData();
+    const uint8* RESTRICT Flags = Particles.Flags.GetData();
+    const float* RESTRICT RestLengths = Particles.RestLengths.GetData();
+    const FVector3f Anchor = Positions[AnchorIndex];
+    // Walking up, segment i - 1 lies between particle i and the anchor; walking down, segment i does.
+    const int32 Step = AnchorIndex == 0 ? 1 : -1;
+    const int32 SegmentOffset = AnchorIndex == 0 ? -1 : 0;
+    float MaxDistance = 0.0f;
+
+    for (int32 i = AnchorIndex + Step; i >= 0 && i < NumPoints; i += Step)
+    {
+        MaxDistance += RestLengths[i + SegmentOffset];
+        if (Flags[i] & FFishingLineParticles::Flag_Fixed) continue;
+
+        const FVector3f FromAnchor = Positions[i] - Anchor;
+        const float DistanceSq = FromAnchor.SizeSquared();
+        if (DistanceSq > MaxDistance * MaxDistance)
+        {
+            Positions[i] = Anchor + FromAnchor * (MaxDistance / FMath::Sqrt(DistanceSq));
+        }
+    }
+}
+
+float FishingLineSolver::ComputeMaxRelativeError(const FFishingLineParticles& Particles)
+{
+    const int32 NumSegments = Particles.Num() - 1;
+    const FVector3f* RESTRICT Positions = Particles.Positions.GetData();
+    const float* RESTRICT RestLengths = Particles.RestLengths.GetData();
+
+    float MaxError = 0.0f;
+    for (int32 i = 0; i < NumSegments; ++i)
+    {
+        if (RestLengths[i] <= 0.0f) continue;
+        const float Length = FVector3f::Dist(Positions[i], Positions[i + 1]);
+        MaxError = FMath::Max(MaxError, FMath::Abs(Length - RestLengths[i]) / RestLengths[i]);
+    }
+    return MaxError;
+}
+
+bool FishingLineSolver::IsISPCAvailable()
+{
+#if INTEL_ISPC
+    return true;
+#else
+    return false;
+#endif
+}
+
+float FishingLineSolver::SolveDistanceConstraintsISPC(FFishingLineParticles& Particles, int32 Iterations, float Stiffness)
+{
+#if INTEL_ISPC
+    const int32 NumSegments = Particles.Num() - 1;
+    if (NumSegments < 1) return 0.0f;
+
+    return ispc::SolveDistanceConstraintsRedBlack(&Particles.Positions[0].X, Particles.Flags.GetData(), Particles.RestLengths.GetData(), NumSegments, Iterations, Stiffness);
+#else
+    return SolveDistanceConstraints(Particles, Iterations, Stiffness);
+#endif
+}
+
+void FishingLineSolver::SolveCollisions(FFishingLineParticles& Particles, TConstArrayView<FFishingLineCollisionShape> Shapes, float ParticleRadius)
+{
+    const int32 NumPoints = Particles.Num();
+    if (NumPoints == 0 || Shapes.Num() == 0) return;
+
+    // Shapes are cached in world space; bring them into the particles' solver space once per call rather than taking
+    // every particle back to world space.
+    struct FSolverSpaceShape
+    {
+        FVector3f Center;
+        FQuat4f Rotation;
+        FVector3f Extents;
+        FBox3f Bounds;
+        FFishingLineCollisionShape::EShapeType Type;
+    };
+    TArray<FSolverSpaceShape, TInlineAllocator<32>> SolverShapes;
+    SolverShapes.Reserve(Shapes.Num());
+    for (const FFishingLineCollisionShape& Shape : Shapes)
+    {
+        SolverShapes.Add({ Particles.ToLocal(Shape.Center), FQuat4f(Shape.Rotation), FVector3f(Shape.Extents),
+            FBox3f(Particles.ToLocal(Shape.Bounds.Min), Particles.ToLocal(Shape.Bounds.Max)), Shape.Type });
+    }
+
+    FVector3f* RESTRICT Positions = Particles.Positions.GetData();
+    const uint8* RESTRICT Flags = Particles.Flags.GetData();
+
+    for (int32 i = 0; i < NumPoints; ++i)
+    {
+        if (Flags[i] & FFishingLineParticles::Flag_Fixed) continue;
+
+        FVector3f& Position = Positions[i];
+        for (const FSolverSpaceShape& Shape : SolverShapes)
+        {
+            // Bounds are inflated by the particle radius when the shape is cached.
+            if (!Shape.Bounds.IsInsideOrOn(Position)) continue;
+
+            const FVector3f Local = Shape.Rotation.UnrotateVector(Position - Shape.Center);
+            switch (Shape.Type)
+            {
+            case FFishingLineCollisionShape::Shape_Sphere:
+            case FFishingLineCollisionShape::Shape_Capsule:
+            {
+                // A sphere is a capsule with no half height: push out from the closest point on the core segment.
+                const FVector3f Core(0.0f, 0.0f, FMath::Clamp(Local.Z, -Shape.Extents.Z, Shape.Extents.Z));
+                const FVector3f FromCore = Local - Core;
+                const float Distance = FromCore.Size();
+                const float Radius = Shape.Extents.X + ParticleRadius;
+                if (Distance >= Radius) break;
+
+                const FVector3f Normal = Distance > UE_KINDA_SMALL_NUMBER ? FromCore / Distance : FVector3f::UpVector;
+                Position = Shape.Center + Shape.Rotation.RotateVector(Core + Normal * Radius);
+                break;
+            }
+            case FFishingLineCollisionShape::Shape_Box:
+            {
+                // Push out through the face with the least penetration.
+                const FVector3f Extents = Shape.Extents + FVector3f(ParticleRadius);
+                const FVector3f Penetration = Extents - Local.GetAbs();
+                if (Penetration.X <= 0.0f || Penetration.Y <= 0.0f || Penetration.Z <= 0.0f) break;
+
+                FVector3f Resolved = Local;
+                const int32 Axis = (Penetration.X < Penetration.Y) ? (Penetration.X < Penetration.Z ? 0 : 2) : (Penetration.Y < Penetration.Z ? 1 : 2);
+                Resolved[Axis] = Local[Axis] >= 0.0f ? Extents[Axis] : -Extents[Axis];
+                Position = Shape.Center + Shape.Rotation.RotateVector(Resolved);
+                break;
+            }
+            }
+        }
+    }
+}
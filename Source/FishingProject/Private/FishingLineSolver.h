@@ -0,0 +1,104 @@
+// FishingLineSolver.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+struct FFishingLineParticles;
+struct FFishingLineSolverScratch;
+struct FFishingLineCollisionShape;
+
+DECLARE_STATS_GROUP(TEXT("FishingLine"), STATGROUP_FishingLine, STATCAT_Advanced);
+
+/**
+ * Stateless kernels used by UFishingLineComponent to step its particles.
+ * They only operate on FFishingLineParticles, so they can be driven by the component or by the benchmark command
+ * without a world or a component instance. All of them work in the particles' single-precision solver space.
+ */
+namespace FishingLineSolver
+{
+    /**
+     * Verlet-integrates particles in [StartIndex, EndIndex). Fixed particles inside the range keep their position and
+     * have their accumulated acceleration cleared, matching FVerletPoint::Integrate.
+     */
+    void Integrate(FFishingLineParticles& Particles, int32 StartIndex, int32 EndIndex, float DeltaTime, float DampingFactor, const FVector3f& Gravity);
+
+    /**
+     * Same result as Integrate, four particles per step using VectorRegister4Float. Fixed particles are blended out
+     * with a 0/1 weight instead of a branch; the range tail that does not fill a batch falls back to Integrate.
+     */
+    void IntegrateVectorized(FFishingLineParticles& Particles, int32 StartIndex, int32 EndIndex, float DeltaTime, float DampingFactor, const FVector3f& Gravity);
+
+    /**
+     * Gauss-Seidel projection of the chain's distance constraints (particle i to i+1 at RestLengths[i]), Iterations sweeps.
+     * A fixed end of a segment does not move; otherwise the correction is split evenly between both ends.
+     * Returns the largest relative length error (|length - rest| / rest) the last sweep found and corrected, a
+     * convergence measure that costs nothing extra.
+     */
+    float SolveDistanceConstraints(FFishingLineParticles& Particles, int32 Iterations, float Stiffness);
+
+    /**
+     * Block-parallel variant of SolveDistanceConstraints for long lines, with two ParallelFor dispatches per call however
+     * many sweeps are asked for. Each task owns a block of SegmentsPerTask segments and runs its Gauss-Seidel sweeps on
+     * them, leaving out the block's last segment so that no two blocks share a particle. The second dispatch shifts the
+     * blocks by half a block, so the segments left out of the first are solved in it; the sweeps are split between the two.
+     * A single sweep runs one dispatch and then projects the left-out segments on the calling thread.
+     * Returns the largest relative length error of the last round's last sweep, as SolveDistanceConstraints does.
+     */
+    float SolveDistanceConstraintsParallel(FFishingLineParticles& Particles, int32 Iterations, float Stiffness, int32 SegmentsPerTask);
+
+    /**
+     * Direct solve of all chain constraints at once. Each pass linearizes C_j = |x_j+1 - x_j| - RestLengths[j] around the
+     * current positions and solves (J W J^T) lambda = -C exactly. For a chain that matrix is tridiagonal, so the Thomas
+     * algorithm does it in O(N). W uses the particles' inverse masses, zero for fixed particles.
+     */
+    void SolveDistanceConstraintsDirect(FFishingLineParticles& Particles, FFishingLineSolverScratch& Scratch, int32 Passes);
+
+    /**
+     * XPBD projection of the chain constraints, Iterations Gauss-Seidel sweeps. Each segment accumulates its own
+     * Lagrange multiplier, and Compliance / DeltaTime^2 is added to the constraint's effective mass. The converged result
+     * depends on Compliance, not on how many sweeps were run. Multipliers must be reset once per step; pass
+     * bResetMultipliers = false to continue the same step's solve after something else (e.g. contacts) moved particles.
+     */
+    void SolveDistanceConstraintsXPBD(FFishingLineParticles& Particles, FFishingLineSolverScratch& Scratch, int32 Iterations, float Compliance, float DeltaTime, bool bResetMultipliers = true);
+
+    /**
+     * Coarse-to-fine stage of the Multigrid mode, to be followed by ordinary sweeps on the full line. Level L is the chain
+     * of every CoarseningFactor^L-th particle (plus the last), with each coarse segment allowed the summed rest length of
+     * the fine segments it spans. Starting from the coarsest, each level gets Iterations sweeps, and the moves of its
+     * nodes are blended by rest arc length onto the particles between them.
+     * Coarse constraints only resist stretch: a bent fine chain is legitimately shorter than its arc between two nodes.
+     */
+    void SolveCoarseLevels(FFishingLineParticles& Particles, FFishingLineSolverScratch& Scratch, int32 NumLevels, int32 CoarseningFactor, int32 Iterations);
+
+    /**
+     * Long-range attachments: clamps each free particle to within its rest distance along the line (the sum of the
+     * RestLengths between them) of the anchor, the rod tip. AnchorIndex is 0 or Num() - 1; the other particles are
+     * walked away from it.
+     * Every particle is independent of the others, so this is a single pass with no ordering dependency.
+     */
+    void ApplyLongRangeAttachments(FFishingLineParticles& Particles, int32 AnchorIndex);
+
+    /**
+     * Projects free particles, as spheres of ParticleRadius, out of the cached world shapes. Each particle is only tested
+     * against shapes whose inflated bounds contain it, so the cost is particles x nearby shapes, with no scene queries.
+     */
+    void SolveCollisions(FFishingLineParticles& Particles, TConstArrayView<FFishingLineCollisionShape> Shapes, float ParticleRadius);
+
+    /**
+     * Largest |length - RestLengths[i]| / RestLengths[i] over all segments, the convergence measure for adaptive sweep
+     * counts. A segment with a non-positive rest length is skipped.
+     */
+    float ComputeMaxRelativeError(const FFishingLineParticles& Particles);
+
+    /** True when the module was built with ISPC and SolveDistanceConstraintsISPC runs the compiled kernel. */
+    bool IsISPCAvailable();
+
+    /**
+     * ISPC version of SolveDistanceConstraints. Within a sweep it projects even segments, then odd ones, with one segment
+     * per program instance, so it converges like a red-black sweep rather than a strict Gauss-Seidel one.
+     * Falls back to SolveDistanceConstraints when ISPC is not available. Returns the same measure as SolveDistanceConstraints.
+     */
+    float SolveDistanceConstraintsISPC(FFishingLineParticles& Particles, int32 Iterations, float Stiffness);
+}
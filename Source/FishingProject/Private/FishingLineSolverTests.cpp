@@ -0,0 +1,120 @@
+// FishingLineSolverTests.cpp
+// Automation tests for the stateless fishing line kernels. Run with: Automation RunTests FishingProject.Line
+
+#include "FishingLineComponent.h"
+#include "FishingLineSolver.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FishingLineSolverTests
+{
+    static const float TestDeltaTime = 1.0f / 60.0f;
+    static const float TestDamping = 0.1f;
+    static const FVector TestGravity(0.0, 0.0, -980.0);
+    static const int32 TestFrames = 30;
+
+    /**
+     * The scalar and vectorized kernels run the same float operations, except that the vectorized one rebuilds the old
+     * position as Old + Weight * (Pos - Old), which can round by an ulp. Over TestFrames, on a line that stays within a
+     * couple of metres of its origin, that stays well under this, in cm.
+     */
+    static const double VectorizedTolerance = 1e-3;
+    /** The float kernels against FVerletPoint::Integrate, which runs the same formula in double. */
+    static const double ReferenceTolerance = 5e-3;
+
+    /**
+     * 37 particles (not a multiple of four, so the vectorized tail runs), every 7th one pinned, each with its own initial
+     * velocity. Accelerations are refilled every frame so the per-particle force path is exercised too.
+     */
+    static void MakePoints(TArray<FVerletPoint>& OutPoints)
+    {
+        const int32 NumPoints = 37;
+        OutPoints.Reset(NumPoints);
+        for (int32 i = 0; i < NumPoints; ++i)
+        {
+            FVerletPoint& Point = OutPoints.Emplace_GetRef(FVector(i * 10.0, 0.0, 0.0), 0.01f, i % 7 == 0);
+            Point.OldPosition = Point.Position - FVector(0.1 * (i % 3), -0.05 * (i % 5), 0.2);
+        }
+    }
+
+    static FVector GetTestAcceleration(int32 Index, int32 Frame)
+    {
+        return FVector(50.0 * FMath::Sin(0.3 * Index + 0.1 * Frame), 20.0 * (Index % 4), -10.0 * (Frame % 3));
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFishingLineIntegrateTest, "FishingProject.Line.Integrate",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::ProductFilter)
+
+bool FFishingLineIntegrateTest::RunTest(const FString& Parameters)
+{
+    using namespace FishingLineSolverTests;
+
+    TArray<FVerletPoint> InitialPoints;
+    MakePoints(InitialPoints);
+    const int32 NumPoints = InitialPoints.Num();
+
+    // The whole free range, as the component integrates it, and a range that starts and ends mid-line.
+    const TPair<int32, int32> Ranges[] = { { 1, NumPoints }, { 3, NumPoints - 2 } };
+    for (const TPair<int32, int32>& Range : Ranges)
+    {
+        const int32 StartIndex = Range.Key;
+        const int32 EndIndex = Range.Value;
+
+        TArray<FVerletPoint> ReferencePoints = InitialPoints;
+        FFishingLineParticles ScalarParticles;
+        ScalarParticles.Reset(NumPoints);
+        for (const FVerletPoint& Point : InitialPoints)
+        {
+            ScalarParticles.AddPoint(Point);
+        }
+        FFishingLineParticles VectorParticles = ScalarParticles;
+
+        for (int32 Frame = 0; Frame < TestFrames; ++Frame)
+        {
+            for (int32 i = 0; i < NumPoints; ++i)
+            {
+                const FVector Acceleration = GetTestAcceleration(i, Frame);
+                ReferencePoints[i].Acceleration = Acceleration;
+                ScalarParticles.Accelerations[i] = FVector3f(Acceleration);
+                VectorParticles.Accelerations[i] = FVector3f(Acceleration);
+            }
+            for (int32 i = StartIndex; i < EndIndex; ++i)
+            {
+                ReferencePoints[i].Integrate(TestDeltaTime, TestDamping, TestGravity);
+            }
+            FishingLineSolver::Integrate(ScalarParticles, StartIndex, EndIndex, TestDeltaTime, TestDamping, FVector3f(TestGravity));
+            FishingLineSolver::IntegrateVectorized(VectorParticles, StartIndex, EndIndex, TestDeltaTime, TestDamping, FVector3f(TestGravity));
+        }
+
+        double MaxVectorDeviation = 0.0;
+        double MaxReferenceDeviation = 0.0;
+        bool bAccelerationsCleared = true;
+        for (int32 i = 0; i < NumPoints; ++i)
+        {
+            MaxVectorDeviation = FMath::Max(MaxVectorDeviation, FVector::Dist(ScalarParticles.GetWorldPosition(i), VectorParticles.GetWorldPosition(i)));
+            MaxVectorDeviation = FMath::Max(MaxVectorDeviation, double(FVector3f::Dist(ScalarParticles.OldPositions[i], VectorParticles.OldPositions[i])));
+            MaxReferenceDeviation = FMath::Max(MaxReferenceDeviation, FVector::Dist(ReferencePoints[i].Position, ScalarParticles.GetWorldPosition(i)));
+            MaxReferenceDeviation = FMath::Max(MaxReferenceDeviation, FVector::Dist(ReferencePoints[i].OldPosition, ScalarParticles.ToWorld(ScalarParticles.OldPositions[i])));
+
+            // Both kernels clear accelerations inside their range, fixed particles included, and leave the rest alone.
+            const bool bInRange = i >= StartIndex && i < EndIndex;
+            for (const FFishingLineParticles* Particles : { &ScalarParticles, &VectorParticles })
+            {
+                bAccelerationsCleared &= Particles->Accelerations[i].IsZero() == bInRange;
+            }
+        }
+
+        const FString Context = FString::Printf(TEXT("range [%d, %d)"), StartIndex, EndIndex);
+        TestTrue(FString::Printf(TEXT("IntegrateVectorized matches Integrate within %g cm (%s, max deviation %g)"), VectorizedTolerance, *Context, MaxVectorDeviation),
+            MaxVectorDeviation <= VectorizedTolerance);
+        TestTrue(FString::Printf(TEXT("Integrate matches FVerletPoint::Integrate within %g cm (%s, max deviation %g)"), ReferenceTolerance, *Context, MaxReferenceDeviation),
+            MaxReferenceDeviation <= ReferenceTolerance);
+        TestTrue(FString::Printf(TEXT("Accelerations cleared exactly inside the range (%s)"), *Context), bAccelerationsCleared);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
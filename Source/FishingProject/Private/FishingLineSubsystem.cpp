@@ -0,0 +1,145 @@
+// FishingLineSubsystem.cpp
+
+#include "FishingLineSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "FishingLogChannels.h"
+
+static TAutoConsoleVariable<int32> CVarFishingLineBatchedSimulation(
+    TEXT("r.Fishing.Line.BatchedSimulation"),
+    1,
+    TEXT("Step fishing lines from UFishingLineSubsystem instead of each line's own tick.\n")
+    TEXT("0: Every line ticks itself (honours r.Fishing.Line.AsyncSimulation)\n")
+    TEXT("1: One batched pass per frame, lines simulated in parallel (default)"),
+    ECVF_Default);
+
+bool UFishingLineSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void FFishingLineBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (Subsystem)
+    {
+        Subsystem->Tick(DeltaTime);
+    }
+}
+
+FString FFishingLineBatchTickFunction::DiagnosticMessage()
+{
+    return TEXT("FFishingLineBatchTickFunction");
+}
+
+void UFishingLineSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    BatchTickFunction.Subsystem = this;
+    BatchTickFunction.TickGroup = TG_PostPhysics;
+    BatchTickFunction.bCanEverTick = true;
+    BatchTickFunction.bStartWithTickEnabled = true;
+    BatchTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UFishingLineSubsystem::Deinitialize()
+{
+    if (BatchTickFunction.IsTickFunctionRegistered())
+    {
+        BatchTickFunction.UnRegisterTickFunction();
+    }
+    BatchTickFunction.Subsystem = nullptr;
+    SetLinesBatched(false);
+    Lines.Empty();
+    ActiveLines.Empty();
+    ActiveInputs.Empty();
+    Super::Deinitialize();
+}
+
+void UFishingLineSubsystem::RegisterLine(UFishingLineComponent* Line)
+{
+    if (!Line) return;
+
+    Lines.AddUnique(Line);
+    SetLinesBatched(CVarFishingLineBatchedSimulation.GetValueOnGameThread() != 0);
+    Line->SetComponentTickEnabled(!bLinesBatched);
+    UE_LOG(LogFishingSystemLine, Verbose, TEXT("UFishingLineSubsystem: Registered '%s'. %d lines, batched: %s."),
+        *Line->GetName(), Lines.Num(), bLinesBatched ? TEXT("TRUE") : TEXT("FALSE"));
+}
+
+void UFishingLineSubsystem::UnregisterLine(UFishingLineComponent* Line)
+{
+    if (!Line) return;
+
+    // Hand the line its own tick back, in case it begins play again without the subsystem batching it.
+    Lines.Remove(Line);
+    Line->SetComponentTickEnabled(true);
+}
+
+void UFishingLineSubsystem::SetLinesBatched(bool bBatched)
+{
+    if (bBatched == bLinesBatched) return;
+
+    bLinesBatched = bBatched;
+    for (UFishingLineComponent* Line : Lines)
+    {
+        if (Line)
+        {
+            Line->SetComponentTickEnabled(!bBatched);
+        }
+    }
+}
+
+void UFishingLineSubsystem::Tick(float DeltaTime)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_FishingLineSubsystem_Tick);
+
+    SetLinesBatched(CVarFishingLineBatchedSimulation.GetValueOnGameThread() != 0);
+    if (!bLinesBatched || Lines.Num() == 0) return;
+
+    // Game thread: everything that reads the scene or changes a line's particle count.
+    ActiveLines.Reset();
+    ActiveInputs.Reset();
+    for (UFishingLineComponent* Line : Lines)
+    {
+        if (!Line || !Line->IsRegistered()) continue;
+
+        // Stepped by the physics solver; the game thread only trades inputs and results with it.
+        if (Line->IsSimulatedInPhysicsThread())
+        {
+            Line->TickPhysicsThreadSimulation(DeltaTime);
+            continue;
+        }
+
+        // A line switched over from async mode may still have a step in flight.
+        Line->CompleteAsyncSimulation();
+
+        FFishingLineStepInputs Inputs;
+        if (Line->PrepareSimulation(DeltaTime, Inputs))
+        {
+            ActiveLines.Add(Line);
+            ActiveInputs.Add(Inputs);
+        }
+    }
+
+    // Workers: each line only touches its own particles and its back frame result. Lines already fill the workers then, so
+    // a long line does not also fan its own solve out from inside this ParallelFor.
+    if (ActiveLines.Num() > 1)
+    {
+        for (FFishingLineStepInputs& Inputs : ActiveInputs)
+        {
+            Inputs.bParallelSolve = false;
+        }
+    }
+    ParallelFor(ActiveLines.Num(), [this](int32 Index)
+    {
+        UFishingLineComponent* Line = ActiveLines[Index];
+        Line->RunSimulation(ActiveInputs[Index], Line->GetBackFrameResult());
+    });
+
+    // Game thread: mesh upload and sleep bookkeeping.
+    for (UFishingLineComponent* Line : ActiveLines)
+    {
+        Line->PublishFrameResult();
+    }
+}
@@ -90,12 +90,23 @@ void AFishingRod::OnConstruction(const FTransform& Transform)
             FishingLineComponent->SetVisibility(false);
             FishingLineComponent->TargetCableLength = 10.0f; // Initial small length
             FishingLineComponent->DesiredSegmentLength = 10.0f; // Default, can be overridden by BP_Line defaults
+            FishingLineComponent->bUseAdaptiveResolution = true; // Fine segments at the tip and the bobber, coarse in the middle of a cast
+            FishingLineComponent->MaxSegmentLength = 60.0f;
+            FishingLineComponent->AdaptiveBlendDistance = 200.0f;
             FishingLineComponent->SolverIterations = 10;
+            FishingLineComponent->bUseAdaptiveIterations = true; // Settled lines stop after a couple of sweeps; 10 is only the cap
+            FishingLineComponent->SolverTolerance = 0.01f;
             FishingLineComponent->CableWidth = 2.0f;
+            FishingLineComponent->SolverType = EFishingLineSolverType::GaussSeidel; // Tuned with StiffnessFactor below; XPBD would use LineCompliance instead
             FishingLineComponent->StiffnessFactor = 0.85f; // Rod's preferred default
+            FishingLineComponent->bUseLongRangeAttachments = true; // Keeps long casts from stretching past CurrentLineLengthSetting
+            FishingLineComponent->bEnableWorldCollision = true; // Lines rest on docks and rocks instead of passing through them
             FishingLineComponent->DampingFactor = 0.1f;   // Rod's preferred default
             FishingLineComponent->CableGravityScale = 1.0f;
             FishingLineComponent->DefaultParticleMass = 0.01f; // Rod's preferred default
+            FishingLineComponent->bUseFixedTimestep = true; // Same solver work per simulated second on every machine
+            FishingLineComponent->FixedSimulationRate = 60.0f;
+            FishingLineComponent->MaxSubstepsPerFrame = 4;
             // bAutoSpawnAndAttachBobber was removed from UFishingLineComponent
             FishingLineComponent->bUseBezierInitialization = false;
             FishingLineComponent->MeshTessellation = 4;
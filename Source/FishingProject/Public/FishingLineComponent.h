@@ -4,11 +4,16 @@
 
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
+#include "Tasks/Task.h"
 #include "FishingLineComponent.generated.h"
 
 // Forward declarations
 class UProceduralMeshComponent;
+class UFishingLineMeshComponent;
 class UMaterialInterface;
+class UPrimitiveComponent;
+class UFishingLineSubsystem;
+class FFishingLinePhysicsCallback;
 // class AFishingBobber; // No longer needed here as line doesn't spawn/manage bobbers
 
 USTRUCT(BlueprintType)
@@ -65,12 +70,303 @@ struct FVerletPoint
     }
 };
 
+/**
+ * Structure-of-arrays storage for the line's particles.
+ * Each attribute lives in its own contiguous array so the integration and constraint passes only stream what they touch
+ * (the constraint sweep reads Positions and Flags, nothing else). FVerletPoint stays the per-particle view: use
+ * AddPoint/GetPoint/SetPoint when a single particle needs to be read or written as a whole.
+ *
+ * Positions are single precision and relative to SpaceOrigin, which the owner keeps near the rod tip (see Rebase), so a
+ * line far from the world origin keeps its precision while the solver streams half the bytes of FVector. FVerletPoint
+ * stays in world space: AddPoint/GetPoint/SetPoint convert at the boundary.
+ */
+struct FFishingLineParticles
+{
+    enum EParticleFlags : uint8
+    {
+        Flag_None  = 0,
+        Flag_Fixed = 1 << 0,
+    };
+
+    TArray<FVector3f> Positions;
+    TArray<FVector3f> OldPositions;
+    TArray<FVector3f> Accelerations;
+    /** 1 / Mass. Kept for fixed particles too, so toggling Flag_Fixed does not lose the particle's mass. */
+    TArray<float> InverseMasses;
+    TArray<uint8> Flags;
+    /** Per segment, not per particle: RestLengths[i] is the rest length between particle i and i + 1. Filled by the owner. */
+    TArray<float> RestLengths;
+    /** World location Positions and OldPositions are relative to. Not touched by Reset/Empty. */
+    FVector SpaceOrigin = FVector::ZeroVector;
+
+    int32 Num() const { return Positions.Num(); }
+
+    FVector3f ToLocal(const FVector& WorldLocation) const { return FVector3f(WorldLocation - SpaceOrigin); }
+    FVector ToWorld(const FVector3f& LocalPosition) const { return SpaceOrigin + FVector(LocalPosition); }
+
+    FVector GetWorldPosition(int32 Index) const { return ToWorld(Positions[Index]); }
+
+    /**
+     * Moves SpaceOrigin to NewOrigin and shifts Positions and OldPositions so their world locations do not change.
+     * Velocities (Position - OldPosition) are preserved exactly since both receive the same offset.
+     */
+    void Rebase(const FVector& NewOrigin)
+    {
+        const FVector3f Offset(SpaceOrigin - NewOrigin);
+        for (int32 i = 0; i < Positions.Num(); ++i)
+        {
+            Positions[i] += Offset;
+            OldPositions[i] += Offset;
+        }
+        SpaceOrigin = NewOrigin;
+    }
+
+    void Reset(int32 NumPoints)
+    {
+        Positions.Reset(NumPoints);
+        OldPositions.Reset(NumPoints);
+        Accelerations.Reset(NumPoints);
+        InverseMasses.Reset(NumPoints);
+        Flags.Reset(NumPoints);
+        RestLengths.Reset(FMath::Max(0, NumPoints - 1));
+    }
+
+    void Empty()
+    {
+        Positions.Empty();
+        OldPositions.Empty();
+        Accelerations.Empty();
+        InverseMasses.Empty();
+        Flags.Empty();
+        RestLengths.Empty();
+    }
+
+    int32 AddPoint(const FVerletPoint& Point)
+    {
+        Positions.Add(ToLocal(Point.Position));
+        OldPositions.Add(ToLocal(Point.OldPosition));
+        Accelerations.Add(FVector3f(Point.Acceleration));
+        InverseMasses.Add(1.0f / FMath::Max(Point.Mass, KINDA_SMALL_NUMBER));
+        return Flags.Add(Point.bIsFixed ? Flag_Fixed : Flag_None);
+    }
+
+    FVerletPoint GetPoint(int32 Index) const
+    {
+        FVerletPoint Point(ToWorld(Positions[Index]), GetMass(Index), IsFixed(Index));
+        Point.OldPosition = ToWorld(OldPositions[Index]);
+        Point.Acceleration = FVector(Accelerations[Index]);
+        return Point;
+    }
+
+    /** Inserts Count zeroed particles before Index, to be filled with SetPoint. Segment rest lengths are left to the caller. */
+    void InsertPoints(int32 Index, int32 Count)
+    {
+        Positions.InsertZeroed(Index, Count);
+        OldPositions.InsertZeroed(Index, Count);
+        Accelerations.InsertZeroed(Index, Count);
+        InverseMasses.InsertZeroed(Index, Count);
+        Flags.InsertZeroed(Index, Count);
+    }
+
+    /** Removes Count particles starting at Index. Segment rest lengths are left to the caller. */
+    void RemovePoints(int32 Index, int32 Count)
+    {
+        Positions.RemoveAt(Index, Count, EAllowShrinking::No);
+        OldPositions.RemoveAt(Index, Count, EAllowShrinking::No);
+        Accelerations.RemoveAt(Index, Count, EAllowShrinking::No);
+        InverseMasses.RemoveAt(Index, Count, EAllowShrinking::No);
+        Flags.RemoveAt(Index, Count, EAllowShrinking::No);
+    }
+
+    void SetPoint(int32 Index, const FVerletPoint& Point)
+    {
+        Positions[Index] = ToLocal(Point.Position);
+        OldPositions[Index] = ToLocal(Point.OldPosition);
+        Accelerations[Index] = FVector3f(Point.Acceleration);
+        SetMass(Index, Point.Mass);
+        SetFixed(Index, Point.bIsFixed);
+    }
+
+    bool IsFixed(int32 Index) const { return (Flags[Index] & Flag_Fixed) != 0; }
+
+    void SetFixed(int32 Index, bool bFixed)
+    {
+        Flags[Index] = bFixed ? (Flags[Index] | Flag_Fixed) : (Flags[Index] & ~Flag_Fixed);
+    }
+
+    float GetMass(int32 Index) const { return 1.0f / InverseMasses[Index]; }
+    void SetMass(int32 Index, float Mass) { InverseMasses[Index] = 1.0f / FMath::Max(Mass, KINDA_SMALL_NUMBER); }
+
+    /** Same contract as FVerletPoint::AddForce: ignored for fixed particles. */
+    void AddForce(int32 Index, const FVector& Force)
+    {
+        if (IsFixed(Index)) return;
+        Accelerations[Index] += FVector3f(Force) * InverseMasses[Index];
+    }
+};
+
+/** Reusable work arrays for solvers that need per-segment temporaries, so a steady-state solve does not allocate. */
+struct FFishingLineSolverScratch
+{
+    TArray<FVector3f> Directions;
+    TArray<double> Diagonal;
+    TArray<double> Upper;
+    TArray<double> UpperPrime;
+    TArray<double> Rhs;
+    TArray<double> Lambdas;
+    /** Multigrid: positions of the current level's coarse nodes before its sweeps, and each particle's rest arc length. */
+    TArray<FVector3f> CoarsePositions;
+    TArray<float> ArcLengths;
+
+    void SetNumSegments(int32 NumSegments)
+    {
+        Directions.SetNumUninitialized(NumSegments, EAllowShrinking::No);
+        Diagonal.SetNumUninitialized(NumSegments, EAllowShrinking::No);
+        Upper.SetNumUninitialized(NumSegments, EAllowShrinking::No);
+        UpperPrime.SetNumUninitialized(NumSegments, EAllowShrinking::No);
+        Rhs.SetNumUninitialized(NumSegments, EAllowShrinking::No);
+        Lambdas.SetNumUninitialized(NumSegments, EAllowShrinking::No);
+    }
+};
+
+/**
+ * Everything a simulation step reads from the world, captured on the game thread by PrepareSimulation so the step
+ * itself (and the mesh build after it) can run on any thread.
+ */
+struct FFishingLineStepInputs
+{
+    float DeltaTime = 0.0f;
+    FTransform ComponentToWorld;
+    FVector StartLocation = FVector::ZeroVector;
+    /** Location of the end attachment; only meaningful when bEndAttached is set. */
+    FVector EndLocation = FVector::ZeroVector;
+    bool bEndAttached = false;
+    /** EndLocation was sampled for this very step (a physics body read on the physics thread), so the end goes straight to it. */
+    bool bEndLocationIsCurrent = false;
+    FVector Gravity = FVector::ZeroVector;
+    bool bVectorIntegrate = true;
+    bool bISPCConstraints = false;
+    /** Allow the line's own ParallelFor solve. Off while the line is one of several already being stepped in parallel. */
+    bool bParallelSolve = true;
+    /** Project particles out of the component's cached collision shapes during the solve. */
+    bool bWorldCollision = false;
+    float ParticleCollisionRadius = 0.0f;
+    /** Location of the closest view rendered last frame, for camera-facing geometry; only meaningful when bHasViewLocation is set. */
+    FVector ViewLocation = FVector::ZeroVector;
+    bool bHasViewLocation = false;
+    /** Rings in the mesh on screen, so adaptive ring counts can keep its size while the line's bends still fit it. */
+    int32 PreviousRenderRings = 0;
+};
+
+/**
+ * A piece of static world geometry cached for the line's narrow phase, in world space.
+ * Sphere: Extents.X is the radius. Capsule: Extents.X is the radius, Extents.Z the half length of its core segment along
+ * the local Z axis. Box: Extents are the half extents.
+ */
+struct FFishingLineCollisionShape
+{
+    enum EShapeType : uint8
+    {
+        Shape_Sphere,
+        Shape_Box,
+        Shape_Capsule,
+    };
+
+    EShapeType Type = Shape_Sphere;
+    FVector Center = FVector::ZeroVector;
+    FQuat Rotation = FQuat::Identity;
+    FVector Extents = FVector::ZeroVector;
+    /** World bounds, inflated by the particle radius, used to skip the shape cheaply. */
+    FBox Bounds = FBox(ForceInit);
+};
+
+/** Cable mesh data in component space, built off the game thread and applied on it. */
+struct FFishingLineMeshData
+{
+    TArray<FVector> Vertices;
+    TArray<int32> Triangles;
+    TArray<FVector> Normals;
+    /** Line direction at each vertex. */
+    TArray<FVector> Tangents;
+    TArray<FVector2D> UVs;
+    FBox Bounds = FBox(ForceInit);
+    /** Ring count and vertices per ring that Triangles was built for. BuildCableMesh only rebuilds it when they change. */
+    int32 TopologyRings = 0;
+    int32 TopologySides = 0;
+    /** Triangles connects open two-vertex ribbon rings rather than closed tube rings. */
+    bool bRibbonTopology = false;
+    /** Spline points the rings were built around, when the line is upsampled for rendering. World space. */
+    TArray<FVector> RenderPoints;
+
+    /** Streams of RingFrames: each ring's local-space frame, one float per ring in each. */
+    enum ERingStream
+    {
+        RingCenterX, RingCenterY, RingCenterZ,
+        RingOffsetNX, RingOffsetNY, RingOffsetNZ,
+        RingOffsetBX, RingOffsetBY, RingOffsetBZ,
+        RingNormalNX, RingNormalNY, RingNormalNZ,
+        RingNormalBX, RingNormalBY, RingNormalBZ,
+        RingTangentX, RingTangentY, RingTangentZ,
+        RingV,
+        NumRingStreams
+    };
+    /** Tube scratch: NumRingStreams streams of ring frames, each padded to a multiple of four rings. */
+    TArray<float, TAlignedHeapAllocator<16>> RingFrames;
+};
+
+/** One frame of simulation output. The component keeps two and flips between them (see PublishFrameResult). */
+struct FFishingLineFrameResult
+{
+    /** World-space particle positions as rendered. */
+    TArray<FVector> Positions;
+    FFishingLineMeshData Mesh;
+    float DeltaTime = 0.0f;
+    /** Constraint sweeps run over all of the frame's steps. */
+    int32 SolverIterations = 0;
+    /** Largest relative segment length error left after the frame's last step. */
+    float SolverResidual = 0.0f;
+};
+
+/** What geometry UFishingLineComponent builds around its particles. */
+UENUM(BlueprintType)
+enum class EFishingLineRenderMode : uint8
+{
+    /** A closed tube of MeshTessellation vertices per particle. */
+    Tube        UMETA(DisplayName = "Tube"),
+    /** Two vertices per particle, spread across the line as seen from the closest view. */
+    Ribbon      UMETA(DisplayName = "Camera-Facing Ribbon"),
+    /** Tube while the closest view is within RibbonDistance of the line, ribbon beyond it. */
+    Automatic   UMETA(DisplayName = "Automatic (By Distance)"),
+};
+
+/** How UFishingLineComponent enforces the length of each segment. */
+UENUM(BlueprintType)
+enum class EFishingLineSolverType : uint8
+{
+    /** SolverIterations relaxation sweeps over the segments, scaled by StiffnessFactor. */
+    GaussSeidel         UMETA(DisplayName = "Gauss-Seidel"),
+    /** Linearizes all segment constraints and solves them together with the tridiagonal (Thomas) algorithm, DirectSolverPasses times. */
+    DirectTridiagonal   UMETA(DisplayName = "Direct (Tridiagonal)"),
+    /** Extended PBD: SolverIterations sweeps with per-segment Lagrange multipliers and LineCompliance, so stiffness does not depend on the sweep count. */
+    XPBD                UMETA(DisplayName = "XPBD"),
+    /**
+     * Solves coarse chains of every MultigridCoarseningFactor-th particle first, which removes stretch spread over many
+     * segments, interpolates their correction onto the particles in between, then finishes with SolverIterations
+     * Gauss-Seidel sweeps on the full line.
+     */
+    Multigrid           UMETA(DisplayName = "Multigrid"),
+};
+
 
 UCLASS(ClassGroup=(Fishing), meta=(BlueprintSpawnableComponent, DisplayName="Fishing Line"), Blueprintable, BlueprintType)
 class FISHINGPROJECT_API UFishingLineComponent : public USceneComponent
 {
     GENERATED_BODY()
 
+    /** Drives PrepareSimulation / RunSimulation / PublishFrameResult for all lines in one batch. */
+    friend class UFishingLineSubsystem;
+    friend class FFishingLinePhysicsCallback;
+
 public:
     UFishingLineComponent();
 
@@ -119,9 +415,26 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Parameters", meta = (ClampMin = "1.0", UIMin = "1.0"))
     float TargetCableLength;
 
+    /** Rest length of every segment, or of the segments at both ends of the line when bUseAdaptiveResolution is set. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Parameters", meta = (ClampMin = "0.1", UIMin = "0.1"))
     float DesiredSegmentLength;
 
+    /**
+     * Vary segment length along the line: DesiredSegmentLength at the rod tip and at the far end, growing smoothly to
+     * MaxSegmentLength over AdaptiveBlendDistance. Long casts get far fewer particles, with the detail kept where the line
+     * is seen up close and where the bobber pulls on it.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Parameters")
+    bool bUseAdaptiveResolution;
+
+    /** Longest segment the adaptive layout uses, reached in the middle of lines longer than twice AdaptiveBlendDistance. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Parameters", meta = (EditCondition = "bUseAdaptiveResolution", ClampMin = "0.1", UIMin = "0.1"))
+    float MaxSegmentLength;
+
+    /** Distance from either end over which segments grow from DesiredSegmentLength to MaxSegmentLength. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Parameters", meta = (EditCondition = "bUseAdaptiveResolution", ClampMin = "1.0", UIMin = "1.0"))
+    float AdaptiveBlendDistance;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cable|Parameters")
     int32 NumSegments;
 
@@ -129,12 +442,65 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable Particles", meta = (ClampMin = "1.0", UIMin = "1.0", EditCondition = "EndAttachmentComponent != nullptr", EditConditionHides))
     float AttachedEndMassMultiplier;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "1", UIMin = "1"))
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics")
+    EFishingLineSolverType SolverType;
+
+    /** Sweeps per step; with bUseAdaptiveIterations, the most a step may run. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "1", UIMin = "1", EditCondition = "SolverType != EFishingLineSolverType::DirectTridiagonal"))
     int32 SolverIterations;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "0.0", UIMin = "0.0", ClampMax="1.0", UIMax="1.0"))
+    /**
+     * Stop sweeping once no segment is off its rest length by more than SolverTolerance, instead of always running
+     * SolverIterations (or DirectSolverPasses) of them. Convergence is checked every few sweeps from the corrections the
+     * last sweep applied, so a slack or settled line costs a handful of sweeps per step.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics")
+    bool bUseAdaptiveIterations;
+
+    /**
+     * Largest |length - rest length| / rest length any segment may have for the adaptive solve to stop early.
+     * With XPBD, keep this above the stretch LineCompliance allows, or every step runs to the cap.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "0.1", EditCondition = "bUseAdaptiveIterations"))
+    float SolverTolerance;
+
+    /**
+     * Lines with at least this many particles run the Gauss-Seidel (and Multigrid fine) sweeps in blocks spread over worker
+     * threads, unless the line is already being solved alongside others by UFishingLineSubsystem. 0 disables the parallel path.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "0", UIMin = "0", EditCondition = "SolverType == EFishingLineSolverType::GaussSeidel || SolverType == EFishingLineSolverType::Multigrid"))
+    int32 ParallelSolveParticleThreshold;
+
+    /** Linearize-and-solve passes per step for the direct solver. One pass is exact for small stretch; a second cleans up large swings. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "1", UIMin = "1", UIMax = "4", EditCondition = "SolverType == EFishingLineSolverType::DirectTridiagonal"))
+    int32 DirectSolverPasses;
+
+    /** Multigrid levels including the full line: 2 adds one coarse chain, 3 a coarser one above it. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "2", UIMin = "2", ClampMax = "4", UIMax = "4", EditCondition = "SolverType == EFishingLineSolverType::Multigrid"))
+    int32 MultigridLevels;
+
+    /** Segments of one level merged into a segment of the next coarser one. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "2", UIMin = "2", UIMax = "16", EditCondition = "SolverType == EFishingLineSolverType::Multigrid"))
+    int32 MultigridCoarseningFactor;
+
+    /** Sweeps run on each coarse level once per step. Coarse chains are short, so these are cheap. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "1", UIMin = "1", UIMax = "8", EditCondition = "SolverType == EFishingLineSolverType::Multigrid"))
+    int32 MultigridCoarseIterations;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "0.0", UIMin = "0.0", ClampMax="1.0", UIMax="1.0", EditCondition = "SolverType == EFishingLineSolverType::GaussSeidel || SolverType == EFishingLineSolverType::Multigrid"))
     float StiffnessFactor; 
 
+    /** XPBD compliance of each segment, i.e. inverse stiffness (cm per N with kg particle masses). 0 is inextensible. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "0.01", EditCondition = "SolverType == EFishingLineSolverType::XPBD"))
+    float LineCompliance;
+
+    /**
+     * Tether every free particle to the rod-tip particle with a max-distance clamp equal to its rest distance along the line.
+     * Removes stretch that accumulates over many segments in one cheap pass, so long lines need fewer SolverIterations.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics")
+    bool bUseLongRangeAttachments;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (ClampMin = "0.0", ClampMax = "0.5"))
     float DampingFactor;
 
@@ -144,6 +510,63 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics")
     float DefaultParticleMass;
 
+    /** Step the simulation at FixedSimulationRate instead of the frame DeltaTime, and interpolate the rendered line between the last two steps. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics")
+    bool bUseFixedTimestep;
+
+    /** Simulation steps per second when bUseFixedTimestep is set. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (EditCondition = "bUseFixedTimestep", ClampMin = "10.0", UIMin = "10.0", UIMax = "240.0"))
+    float FixedSimulationRate;
+
+    /** Upper bound on steps taken in one frame. Time beyond this is dropped, so a hitch slows the line down instead of blowing it up. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Physics", meta = (EditCondition = "bUseFixedTimestep", ClampMin = "1", UIMin = "1", UIMax = "16"))
+    int32 MaxSubstepsPerFrame;
+
+    /**
+     * Step the line inside the Chaos solver, once per physics (sub)step, instead of on the game thread's tick. A pinned end
+     * then follows its body's physics-thread position, so line and bobber advance together. The game thread only prepares
+     * inputs and publishes the newest physics result. Ignores bUseFixedTimestep: the physics step is the fixed step.
+     * Read at BeginPlay.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Cable|Physics")
+    bool bSimulateInPhysicsThread;
+
+    // --- COLLISION PROPERTIES ---
+    /**
+     * Keep particles out of static world geometry. One broad-phase overlap gathers the simple collision shapes around the
+     * line, and that set is reused until the line moves out of the queried region. Contacts are then resolved in the solver.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Collision")
+    bool bEnableWorldCollision;
+
+    /** Channel the broad phase queries with; only primitives that block it are cached. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Collision", meta = (EditCondition = "bEnableWorldCollision"))
+    TEnumAsByte<ECollisionChannel> CollisionChannel;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Collision", meta = (EditCondition = "bEnableWorldCollision", ClampMin = "0.0", UIMin = "0.0", UIMax = "10.0"))
+    float ParticleCollisionRadius;
+
+    /** Extra distance around the line's bounds covered by each broad-phase query. Larger means fewer queries but more cached shapes. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Collision", meta = (EditCondition = "bEnableWorldCollision", ClampMin = "0.0", UIMin = "0.0", UIMax = "1000.0"))
+    float CollisionQueryMargin;
+
+    /** Cap on cached shapes, which bounds the narrow-phase cost per particle. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Collision", meta = (EditCondition = "bEnableWorldCollision", ClampMin = "1", UIMin = "1", UIMax = "256"))
+    int32 MaxCollisionShapes;
+
+    // --- SLEEP PROPERTIES ---
+    /** Stop simulating and re-meshing the line while it and its anchors are at rest. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Sleep")
+    bool bAllowSleep;
+
+    /** The line counts as at rest while its mass-weighted RMS particle speed and its anchors' speeds are below this, in cm/s. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Sleep", meta = (EditCondition = "bAllowSleep", ClampMin = "0.0", UIMin = "0.0", UIMax = "10.0"))
+    float SleepSpeedThreshold;
+
+    /** Consecutive frames at rest before the line falls asleep. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Sleep", meta = (EditCondition = "bAllowSleep", ClampMin = "1", UIMin = "1", UIMax = "120"))
+    int32 SleepFrameCount;
+
     // --- BEZIER PROPERTIES ---
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Bezier")
     bool bUseBezierInitialization;
@@ -161,9 +584,47 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Rendering")
     int32 MeshTessellation;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Rendering")
+    /**
+     * No longer used: tube normals come straight from each ring's frame and are always smooth. Kept so that assets and
+     * Blueprints that set it still load and compile.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "Cable|Rendering")
     bool bSmoothNormals;
 
+    /** Tube, camera-facing ribbon, or either by view distance. A ribbon needs a rendered view and falls back to the tube without one. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Rendering")
+    EFishingLineRenderMode RenderMode;
+
+    /** View distance to the closest particle beyond which Automatic render mode switches to the ribbon, in cm. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Rendering", meta = (EditCondition = "RenderMode == EFishingLineRenderMode::Automatic", ClampMin = "0.0", UIMin = "0.0"))
+    float RibbonDistance;
+
+    /**
+     * Most rings drawn per simulated segment. Above 1, rings are placed on a cubic Hermite spline through the particles, so
+     * a line simulated with long segments still renders smooth. 1 draws one ring per particle.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Rendering", meta = (ClampMin = "1", UIMin = "1", UIMax = "16"))
+    int32 RenderRingsPerSegment;
+
+    /**
+     * Give each segment only as many rings as its bend needs, one per RenderRingAngle, up to RenderRingsPerSegment.
+     * The line's total is padded with collapsed rings at its end to one of a few fixed sizes, and kept there until the
+     * bends need a size up or leave room for two sizes down, so the mesh topology only changes now and then.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Rendering")
+    bool bAdaptiveRenderRings;
+
+    /** Bend, in degrees, covered by each ring of a segment when bAdaptiveRenderRings is set. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cable|Rendering", meta = (EditCondition = "bAdaptiveRenderRings", ClampMin = "0.1", UIMin = "1.0", UIMax = "45.0"))
+    float RenderRingAngle;
+
+    /**
+     * Draw through UFishingLineMeshComponent, whose scene proxy keeps its GPU buffers and only receives new vertices each
+     * frame. Off: rebuild a UProceduralMeshComponent section every frame. Read when the component registers.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Cable|Rendering")
+    bool bUseDynamicMeshProxy;
+
 
     // --- PUBLIC FUNCTIONS ---
     // UFUNCTION(BlueprintCallable, Category = "Cable") void SetAttachEndTo(USceneComponent* EndComponent, FName EndSocketName, FVector RelativeEndLocation = FVector::ZeroVector); // REMOVED - Use AttachCableEndTo
@@ -174,12 +635,32 @@ public:
     UFUNCTION(BlueprintPure, Category = "Cable")
     float GetCurrentCableLength() const { return TargetCableLength; }
 
+    UFUNCTION(BlueprintPure, Category = "Cable")
+    bool IsSleeping() const { return bIsSleeping; }
+
+    /** Constraint sweeps the last published frame ran, summed over its fixed steps. */
+    UFUNCTION(BlueprintPure, Category = "Cable|Stats")
+    int32 GetLastSolverIterations() const { return FrameResults[PublishedFrameResult].SolverIterations; }
+
+    /** Largest relative segment length error the last published frame left, e.g. 0.01 for 1% stretch. */
+    UFUNCTION(BlueprintPure, Category = "Cable|Stats")
+    float GetLastSolverResidual() const { return FrameResults[PublishedFrameResult].SolverResidual; }
+
+    /** Resumes simulation of a sleeping line, e.g. when something outside the line is about to pull on it. */
+    UFUNCTION(BlueprintCallable, Category = "Cable")
+    void WakeLine();
+
+    /**
+     * Particle locations as rendered, i.e. interpolated between simulation steps when bUseFixedTimestep is set.
+     * Always a complete frame: with r.Fishing.Line.AsyncSimulation this is the last published result, one tick behind.
+     */
     UFUNCTION(BlueprintPure, Category = "Cable")
     TArray<FVector> GetParticleLocations() const; // Keep GetParticles() const TArray<FVerletPoint>& if needed by rod for forces
 
     /**
      * Programmatically sets the SceneComponent (e.g., a spawned bobber's root) to attach the end of the cable to.
      * This is the primary method for the FishingRod to attach the line to a bobber.
+     * An existing line keeps its shape and motion; only the end particle's fixed flag and mass change on the next tick.
      * @param NewEndAttachment The component to attach to. If nullptr, the cable end becomes free.
      * @param NewSocketName Optional socket name on the NewEndAttachment.
      */
@@ -197,14 +678,93 @@ public:
     
 protected:
     void RebuildParticles();
-    void SimulateCable(float DeltaTime);
-    void SolveConstraints(float DeltaTime);
-    void UpdateCableMesh();
+    void ComputeSegmentRestLengths(TArray<float>& OutRestLengths) const;
+    float GetAdaptiveSegmentLength(double DistanceAlongLine) const;
+    float ComputeParticleMass(const TArray<float>& SegmentRestLengths, int32 Index) const;
+    void RefreshParticleMass(int32 Index);
+    /** Whether an end attached to EndComponent is pinned to it, as opposed to simulated and followed by it. */
+    bool ShouldFixAttachedEnd(const USceneComponent* EndComponent) const;
+    /**
+     * Brings the end particle's fixed flag and mass in line with the current attachment and bobber state, keeping its
+     * position and velocity. Returns true if anything changed.
+     */
+    bool UpdateEndParticleState();
+    /** Reels in or pays out at the rod tip until the simulated line matches TargetCableLength, without a rebuild. */
+    void SpoolToTargetLength();
+    /** Removes Count particles starting at Index and folds their segments into segment Index - 1. */
+    void RemoveParticleRange(int32 Index, int32 Count);
+    /** Index of the rod tip particle; the line's end is particle 0. */
+    int32 GetTipIndex() const { return Particles.Num() - 1; }
+    void MergeSegmentsNearTip();
+    /** Game-thread part of a tick: rebuild, spool and sleep handling, then snapshot the inputs. False if there is nothing to step. */
+    bool PrepareSimulation(float DeltaTime, FFishingLineStepInputs& OutInputs);
+    /** Steps the particles and builds the mesh into OutResult. Touches no scene state, so it may run in a task. */
+    void RunSimulation(const FFishingLineStepInputs& Inputs, FFishingLineFrameResult& OutResult);
+    /**
+     * Steps the particles by Inputs.DeltaTime (fixed steps if bFixedTimestep) and refreshes the world-space render positions.
+     * AnchorAlpha is the share of the way to Inputs' anchor locations that a single variable step covers; fixed steps work
+     * out their own.
+     */
+    void AdvanceSimulation(const FFishingLineStepInputs& Inputs, bool bFixedTimestep, float AnchorAlpha = 1.0f);
+    FFishingLineFrameResult& GetBackFrameResult() { return FrameResults[1 - PublishedFrameResult]; }
+    /** Makes the back frame result the published one and applies its mesh. Game thread only. */
+    void PublishFrameResult();
+    /** Waits for an in-flight simulation task and publishes its result. */
+    void CompleteAsyncSimulation();
+    /** Waits for an in-flight simulation task and drops its result. */
+    void WaitForAsyncSimulation();
+
+    void RegisterPhysicsCallback();
+    void UnregisterPhysicsCallback();
+    bool IsSimulatedInPhysicsThread() const { return PhysicsCallback != nullptr; }
+    /** Game-thread tick in physics-thread mode: publishes the newest physics result, then hands over the next inputs. */
+    void TickPhysicsThreadSimulation(float DeltaTime);
+    /** Follows the body the physics steps read the pinned end from, or stops following when EndBody is null. */
+    void WatchEndBody(UPrimitiveComponent* EndBody);
+    /** Drops the physics callback's end body before the solver frees its proxy. */
+    UFUNCTION()
+    void OnEndBodyPhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange);
+
+    /**
+     * Moves the anchors and integrates the free particles by DeltaTime. Anchors cover AnchorAlpha of the remaining way from
+     * where the last step left them to this frame's anchor locations.
+     */
+    void SimulateCable(const FFishingLineStepInputs& Inputs, float DeltaTime, float AnchorAlpha);
+    void SolveConstraints(const FFishingLineStepInputs& Inputs, float DeltaTime);
+    /**
+     * Runs Iterations sweeps (or direct passes) of the selected solver. bFirstInStep resets XPBD's multipliers and runs
+     * the Multigrid coarse levels, both of which happen once per step. Returns the largest relative length error, as the
+     * Gauss-Seidel kernels report it from their last sweep; the Direct and XPBD solvers measure it afterwards.
+     */
+    float SolveDistanceConstraints(const FFishingLineStepInputs& Inputs, float DeltaTime, int32 Iterations, bool bFirstInStep);
+    void StepFixedTimestep(const FFishingLineStepInputs& Inputs);
+    void UpdateInterpolatedPositions(const FFishingLineStepInputs& Inputs, float Alpha);
+    /** Re-centres the particles' solver space on NewOrigin, shifting PreviousStepPositions along with them. */
+    void RebaseSolverSpace(const FVector& NewOrigin);
+    /** Positions the simulation side renders from; only safe to read while no simulation task is running. */
+    const TArray<FVector>& GetSimulatedRenderPositions() const;
+    const TArray<FVector>& GetRenderPositions() const;
+    /** Picks the render mode for this frame and builds the matching mesh. Safe off the game thread. */
+    void BuildCableMesh(const TArray<FVector>& Positions, const FFishingLineStepInputs& Inputs, FFishingLineMeshData& OutMesh) const;
+    void BuildTubeMesh(const TArray<FVector>& Positions, const FFishingLineStepInputs& Inputs, FFishingLineMeshData& OutMesh) const;
+    void BuildRibbonMesh(const TArray<FVector>& Positions, const FFishingLineStepInputs& Inputs, FFishingLineMeshData& OutMesh) const;
+    /**
+     * Fills OutPoints with the particles plus the spline points RenderRingsPerSegment adds between them. With adaptive
+     * rings, PreviousNumPoints is the count last drawn, kept if the new points still fit it.
+     */
+    void UpsampleRenderPoints(const TArray<FVector>& Positions, int32 PreviousNumPoints, TArray<FVector>& OutPoints) const;
+    void ApplyCableMesh(const FFishingLineMeshData& Mesh);
+    /** Re-runs the broad-phase overlap when the line has left CollisionQueryBounds. Game thread only. */
+    void UpdateCollisionCache();
+    bool CanSleep() const;
+    FVector GetSleepEndLocation() const;
+    bool HaveAnchorsMovedSinceSleep() const;
+    void UpdateSleepState(float DeltaTime);
     
     
 
     FVector EvaluateCubicBezier(const FVector& P0, const FVector& P1, const FVector& P2, const FVector& P3, float t) const;
-    void GeneratePointsOnBezier(TArray<FVector>& OutPoints, const FVector& P0_World, const FVector& P3_World, int32 PointsToGenerate);
+    void GeneratePointsOnBezier(TArray<FVector>& OutPoints, const FVector& P0_World, const FVector& P3_World, const TArray<float>& CurveParams);
 
     FTransform GetStartTransform() const;
     FTransform GetFreeEndPointTransform() const;
@@ -214,8 +774,55 @@ private:
     UPROPERTY(Transient)
     TObjectPtr<UProceduralMeshComponent> ProceduralMesh;
 
-    TArray<FVerletPoint> Particles;
+    /** Renders the cable instead of ProceduralMesh when bUseDynamicMeshProxy is set. */
+    UPROPERTY(Transient)
+    TObjectPtr<UFishingLineMeshComponent> LineMesh;
+
+    /**
+     * Stored from the line's free or attached end (index 0) to the rod tip (GetTipIndex), the reverse of the order
+     * GetParticleLocations returns, so that reeling in and paying out at the tip work at the cheap end of the arrays.
+     */
+    FFishingLineParticles Particles;
+    FFishingLineSolverScratch SolverScratch;
     FBoxSphereBounds LocalBounds;
+
+    /** Particle positions before the most recent fixed step, the "from" side of render interpolation. Solver space. */
+    TArray<FVector3f> PreviousStepPositions;
+    /**
+     * World-space render positions: blended between PreviousStepPositions and Particles.Positions in fixed-timestep mode,
+     * the current particles otherwise.
+     */
+    TArray<FVector> InterpolatedPositions;
+    /** Simulation time owed but not yet stepped in fixed-timestep mode. Always less than one step after a tick. */
+    float TimeAccumulator;
+    /** Sum of Particles.RestLengths. SpoolToTargetLength brings it back to TargetCableLength when the two differ. */
+    float SimulatedCableLength;
+
+    /** Solver work of the frame being simulated; copied into its FFishingLineFrameResult. Simulation side only. */
+    int32 FrameSolverIterations;
+    float FrameSolverResidual;
+
+    bool bIsSleeping;
+    /** Consecutive frames the line has been at rest; it falls asleep at SleepFrameCount. */
+    int32 SleepCandidateFrames;
+    /** Anchor locations at the end of the last simulated frame, i.e. where they were when the line fell asleep. */
+    FVector LastStartLocation;
+    FVector LastEndLocation;
+
+    /** Static shapes near the line. Written by UpdateCollisionCache on the game thread, read by the solve. */
+    TArray<FFishingLineCollisionShape> CollisionShapes;
+    /** Region the cached shapes were gathered for. */
+    FBox CollisionQueryBounds;
+
+    /** Double buffer of simulation output. Game-thread readers use the published one; a task only ever writes the other. */
+    FFishingLineFrameResult FrameResults[2];
+    int32 PublishedFrameResult;
+    UE::Tasks::FTask SimulationTask;
+    bool bHasPendingFrameResult;
+    /** Set while bSimulateInPhysicsThread is in effect. Owned by the physics solver, which frees it on unregister. */
+    FFishingLinePhysicsCallback* PhysicsCallback;
+    /** Primitive whose body PhysicsCallback->EndBodyProxy points into, watched for its physics state being destroyed. */
+    TWeakObjectPtr<UPrimitiveComponent> WatchedEndBody;
     
     // UPROPERTY(Transient, DuplicateTransient) TObjectPtr<AFishingBobber> ManagedBobber; // REMOVED
     
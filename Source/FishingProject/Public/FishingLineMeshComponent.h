@@ -0,0 +1,59 @@
+// FishingLineMeshComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/MeshComponent.h"
+#include "FishingLineMeshComponent.generated.h"
+
+struct FFishingLineMeshData;
+
+/**
+ * Draws a UFishingLineComponent's cable mesh through its own scene proxy.
+ * The proxy keeps its vertex and index buffers between frames. Each frame only streams the new vertices to the render
+ * thread as dynamic data, which writes just the used range of its dynamic vertex buffers, and indices only when they
+ * changed. The render state is only recreated when the line
+ * outgrows the buffers, which are sized with headroom so that reeling does not do it every few segments.
+ */
+UCLASS(ClassGroup=(Fishing), NotBlueprintable)
+class FISHINGPROJECT_API UFishingLineMeshComponent : public UMeshComponent
+{
+    GENERATED_BODY()
+
+public:
+    UFishingLineMeshComponent();
+
+    /** Takes over Mesh as the mesh to draw from the next frame on. Game thread. */
+    void UpdateMesh(const FFishingLineMeshData& Mesh);
+    /** Stops drawing anything; the buffers are kept for the next UpdateMesh. */
+    void ClearMesh();
+
+    //~ Begin UPrimitiveComponent Interface
+    virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+    virtual int32 GetNumMaterials() const override { return 1; }
+    //~ End UPrimitiveComponent Interface
+
+    //~ Begin UActorComponent Interface
+    virtual void CreateRenderState_Concurrent(FRegisterComponentContext* Context) override;
+    virtual void SendRenderDynamicData_Concurrent() override;
+    //~ End UActorComponent Interface
+
+    //~ Begin USceneComponent Interface
+    virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+    //~ End USceneComponent Interface
+
+private:
+    /** The mesh being drawn, in component space and render-ready precision. */
+    TArray<FVector3f> Vertices;
+    TArray<FVector3f> Normals;
+    TArray<FVector3f> Tangents;
+    TArray<FVector2f> UVs;
+    TArray<uint32> Indices;
+    FBox MeshBounds;
+
+    /** Sizes of the proxy's buffers. UpdateMesh recreates the render state when the mesh no longer fits. */
+    int32 VertexCapacity;
+    int32 IndexCapacity;
+    /** Indices differ from the ones last sent to the proxy. */
+    bool bIndicesDirty;
+};
@@ -0,0 +1,82 @@
+// FishingLineSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "FishingLineComponent.h"
+#include "FishingLineSubsystem.generated.h"
+
+class UFishingLineSubsystem;
+
+/** Runs the subsystem's batched pass in TG_PostPhysics, the group the lines' own tick functions use. */
+USTRUCT()
+struct FFishingLineBatchTickFunction : public FTickFunction
+{
+    GENERATED_BODY()
+
+    UFishingLineSubsystem* Subsystem = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+    virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FFishingLineBatchTickFunction> : public TStructOpsTypeTraitsBase2<FFishingLineBatchTickFunction>
+{
+    enum { WithCopy = false };
+};
+
+/**
+ * Steps every UFishingLineComponent in the world in one batched pass instead of one tick function per line.
+ * The game-thread halves of each line's tick (rebuild, spooling, sleep checks, input snapshot, mesh upload) run
+ * serially. Simulation and mesh building for all awake lines run together in one ParallelFor, so line cost scales
+ * with cores. While batching is on (r.Fishing.Line.BatchedSimulation), the lines' own tick functions are disabled.
+ * The pass runs in the same tick group they did, so anything reading a line (AFishingRod's tension and bobber code,
+ * which ticks before physics and so sees the previous frame's line) gets the same frame whether batching is on or not.
+ *
+ * The subsystem batches scheduling only. It does not own particle storage: each line keeps its own
+ * FFishingLineParticles, and the component is the line, not a handle into a pool. This is deliberate. A line grows
+ * and shrinks at its tip every time it is spooled, so in one shared pool a cast would shift every line stored after
+ * it. The same arrays are also stepped outside this pass: by the line's own tick when batching is off, by the async
+ * task, and by the Chaos callback for physics-thread lines. Each step reads only one line's arrays, so per-line
+ * storage costs this pass nothing in locality.
+ */
+UCLASS()
+class FISHINGPROJECT_API UFishingLineSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin UWorldSubsystem Interface
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+    //~ End UWorldSubsystem Interface
+
+    /** The batched pass. Called by BatchTickFunction. */
+    void Tick(float DeltaTime);
+
+    /** Called by UFishingLineComponent::BeginPlay. */
+    void RegisterLine(UFishingLineComponent* Line);
+    /** Called by UFishingLineComponent::EndPlay. */
+    void UnregisterLine(UFishingLineComponent* Line);
+
+    int32 GetNumLines() const { return Lines.Num(); }
+
+private:
+    /** Hands stepping to the subsystem (true) or back to the lines' own tick functions (false). */
+    void SetLinesBatched(bool bBatched);
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UFishingLineComponent>> Lines;
+
+    FFishingLineBatchTickFunction BatchTickFunction;
+
+    /** Lines that have something to step this frame, and their inputs. Kept between frames so a tick does not allocate. */
+    TArray<UFishingLineComponent*> ActiveLines;
+    TArray<FFishingLineStepInputs> ActiveInputs;
+
+    bool bLinesBatched = false;
+};